@@ -156,6 +156,8 @@ static void mapReactMarkerToPerformanceLogger(
     case ReactMarker::JS_BUNDLE_STRING_CONVERT_STOP:
     case ReactMarker::REGISTER_JS_SEGMENT_START:
     case ReactMarker::REGISTER_JS_SEGMENT_STOP:
+    case ReactMarker::PREPARE_JS_BUNDLE_START:
+    case ReactMarker::PREPARE_JS_BUNDLE_STOP:
       break;
   }
 }
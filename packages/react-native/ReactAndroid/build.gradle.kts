@@ -559,7 +559,7 @@ android {
       externalNativeBuild {
         cmake {
           // We want to build Gtest suite only for the debug variant.
-          targets("reactnative_unittest")
+          targets("reactnative_unittest", "react_featureflags_constexpr_unittest")
         }
       }
     }
@@ -25,6 +25,8 @@ public enum ReactMarkerConstants {
   DESTROY_CATALYST_INSTANCE_END,
   RUN_JS_BUNDLE_START(true),
   RUN_JS_BUNDLE_END(true),
+  PREPARE_JS_BUNDLE_START(true),
+  PREPARE_JS_BUNDLE_END(true),
   NATIVE_MODULE_INITIALIZE_START,
   NATIVE_MODULE_INITIALIZE_END,
   SETUP_REACT_CONTEXT_START,
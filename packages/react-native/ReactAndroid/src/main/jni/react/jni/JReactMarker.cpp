@@ -85,6 +85,12 @@ void JReactMarker::logPerfMarkerWithInstanceKey(
     case ReactMarker::RUN_JS_BUNDLE_STOP:
       JReactMarker::logMarker("RUN_JS_BUNDLE_END", tag, instanceKey);
       break;
+    case ReactMarker::PREPARE_JS_BUNDLE_START:
+      JReactMarker::logMarker("PREPARE_JS_BUNDLE_START", tag, instanceKey);
+      break;
+    case ReactMarker::PREPARE_JS_BUNDLE_STOP:
+      JReactMarker::logMarker("PREPARE_JS_BUNDLE_END", tag, instanceKey);
+      break;
     case ReactMarker::CREATE_REACT_CONTEXT_STOP:
       JReactMarker::logMarker("CREATE_REACT_CONTEXT_END");
       break;
@@ -139,6 +145,12 @@ void JReactMarker::nativeLogMarker(
   } else if (markerNameStr == "RUN_JS_BUNDLE_END") {
     ReactMarker::logMarkerDone(
         ReactMarker::RUN_JS_BUNDLE_STOP, (double)markerTime);
+  } else if (markerNameStr == "PREPARE_JS_BUNDLE_START") {
+    ReactMarker::logMarkerDone(
+        ReactMarker::PREPARE_JS_BUNDLE_START, (double)markerTime);
+  } else if (markerNameStr == "PREPARE_JS_BUNDLE_END") {
+    ReactMarker::logMarkerDone(
+        ReactMarker::PREPARE_JS_BUNDLE_STOP, (double)markerTime);
   } else if (markerNameStr == "CREATE_REACT_CONTEXT_END") {
     ReactMarker::logMarkerDone(
         ReactMarker::CREATE_REACT_CONTEXT_STOP, (double)markerTime);
@@ -72,7 +72,10 @@ JReactInstance::JReactInstance(
           : nullptr);
 
   auto bufferedRuntimeExecutor = instance_->getBufferedRuntimeExecutor();
-  timerManager->setRuntimeExecutor(bufferedRuntimeExecutor);
+  // Timers queued while the JS bundle loads don't need to run before surface
+  // starts and calls from native queued in the meantime.
+  timerManager->setRuntimeExecutor(
+      instance_->getBufferedRuntimeExecutor(SchedulerPriority::NormalPriority));
 
   ReactInstance::JSRuntimeFlags options = {.isProfiling = isProfiling};
   // TODO T194671568 Consider moving runtime init to the JS thread.
@@ -182,10 +182,11 @@ void Instance::loadRAMBundleFromFile(
     const std::string& sourcePath,
     const std::string& sourceURL,
     bool loadSynchronously) {
-  auto bundle = std::make_unique<JSIndexedRAMBundle>(sourcePath.c_str());
+  auto bundle = std::make_unique<JSIndexedRAMBundle>(
+      JSBigFileString::fromPath(sourcePath));
   auto startupScript = bundle->getStartupCode();
   auto registry = RAMBundleRegistry::multipleBundlesRegistry(
-      std::move(bundle), JSIndexedRAMBundle::buildFactory());
+      std::move(bundle), JSIndexedRAMBundle::buildMappedFactory());
   loadRAMBundle(
       std::move(registry),
       std::move(startupScript),
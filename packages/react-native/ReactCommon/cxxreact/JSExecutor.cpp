@@ -15,6 +15,30 @@
 
 namespace facebook::react {
 
+void ExecutorDelegate::callNativeModules(
+    JSExecutor& executor,
+    std::vector<MethodCall>&& calls,
+    bool isEndOfBatch) {
+  auto moduleIds = folly::dynamic::array();
+  auto methodIds = folly::dynamic::array();
+  auto params = folly::dynamic::array();
+  for (auto& call : calls) {
+    moduleIds.push_back(call.moduleId);
+    methodIds.push_back(call.methodId);
+    params.push_back(std::move(call.arguments));
+  }
+
+  // `parseMethodCalls` derives the ids of the following calls from the first
+  // one.
+  auto batch = folly::dynamic::array(
+      std::move(moduleIds), std::move(methodIds), std::move(params));
+  if (!calls.empty() && calls.front().callId != -1) {
+    batch.push_back(calls.front().callId);
+  }
+
+  callNativeModules(executor, std::move(batch), isEndOfBatch);
+}
+
 std::string JSExecutor::getSyntheticBundlePath(
     uint32_t bundleId,
     const std::string& bundlePath) {
@@ -10,6 +10,7 @@
 #include <memory>
 #include <string>
 
+#include <cxxreact/MethodCall.h>
 #include <cxxreact/NativeModule.h>
 #include <folly/dynamic.h>
 #include <jsinspector-modern/InspectorInterfaces.h>
@@ -40,6 +41,16 @@ class ExecutorDelegate {
       JSExecutor& executor,
       folly::dynamic&& calls,
       bool isEndOfBatch) = 0;
+  /**
+   * Same as above, for batches which were already decoded (e.g. from the
+   * binary batch format, see `parseMethodCalls`).
+   * The default implementation converts the calls back to the `folly::dynamic`
+   * format and forwards them to the overload above.
+   */
+  virtual void callNativeModules(
+      JSExecutor& executor,
+      std::vector<MethodCall>&& calls,
+      bool isEndOfBatch);
   virtual MethodCallResult callSerializableNativeHook(
       JSExecutor& executor,
       unsigned int moduleId,
@@ -7,11 +7,16 @@
 
 #include "JSIndexedRAMBundle.h"
 
+#include <folly/portability/SysMman.h>
+#include <folly/portability/Unistd.h>
 #include <glog/logging.h>
+#include <cstring>
 #include <fstream>
 #include <memory>
 #include <sstream>
 
+#include "SystraceSection.h"
+
 namespace facebook::react {
 
 std::function<std::unique_ptr<JSModulesUnbundle>(std::string)>
@@ -21,6 +26,14 @@ JSIndexedRAMBundle::buildFactory() {
   };
 }
 
+std::function<std::unique_ptr<JSModulesUnbundle>(std::string)>
+JSIndexedRAMBundle::buildMappedFactory() {
+  return [](const std::string& bundlePath) {
+    return std::make_unique<JSIndexedRAMBundle>(
+        JSBigFileString::fromPath(bundlePath));
+  };
+}
+
 JSIndexedRAMBundle::JSIndexedRAMBundle(const char* sourcePath) {
   m_bundle = std::make_unique<std::ifstream>(sourcePath, std::ifstream::binary);
   if (!m_bundle) {
@@ -45,6 +58,12 @@ JSIndexedRAMBundle::JSIndexedRAMBundle(
   init();
 }
 
+JSIndexedRAMBundle::JSIndexedRAMBundle(
+    std::unique_ptr<const JSBigFileString> bundle)
+    : m_mappedBundle(std::move(bundle)) {
+  init();
+}
+
 void JSIndexedRAMBundle::init() {
   // read in magic header, number of entries, and length of the startup section
   uint32_t header[3];
@@ -64,16 +83,25 @@ void JSIndexedRAMBundle::init() {
   readBundle(reinterpret_cast<char*>(m_table.data.get()), m_table.byteLength());
 
   // read the startup code
-  m_startupCode = std::unique_ptr<JSBigBufferString>(
-      new JSBigBufferString{startupCodeSize - 1});
+  if (m_mappedBundle) {
+    // Map the startup code on its own, so that it can outlive the bundle.
+    // The nul terminator stored in the file follows it.
+    mappedData(m_baseOffset, startupCodeSize);
+    m_startupCode = std::make_unique<JSBigFileString>(
+        m_mappedBundle->fd(), startupCodeSize - 1, m_baseOffset);
+    return;
+  }
 
-  readBundle(m_startupCode->data(), startupCodeSize - 1);
+  auto startupCode = std::make_unique<JSBigBufferString>(startupCodeSize - 1);
+  readBundle(startupCode->data(), startupCodeSize - 1);
+  m_startupCode = std::move(startupCode);
 }
 
 JSIndexedRAMBundle::Module JSIndexedRAMBundle::getModule(
     uint32_t moduleId) const {
   Module ret;
   ret.name = folly::to<std::string>(moduleId, ".js");
+  SystraceSection s("JSIndexedRAMBundle::getModule", "module", ret.name);
   ret.code = getModuleCode(moduleId);
   return ret;
 }
@@ -95,16 +123,63 @@ std::string JSIndexedRAMBundle::getModuleCode(const uint32_t id) const {
         folly::to<std::string>("Error loading module", id, "from RAM Bundle"));
   }
 
+  const size_t position =
+      m_baseOffset + folly::Endian::little(moduleData->offset);
+  if (m_mappedBundle) {
+    return std::string(mappedData(position, length - 1), length - 1);
+  }
+
   std::string ret(length - 1, '\0');
-  readBundle(
-      &ret.front(),
-      length - 1,
-      m_baseOffset + folly::Endian::little(moduleData->offset));
+  readBundle(&ret.front(), length - 1, position);
   return ret;
 }
 
+void JSIndexedRAMBundle::prefetchModules(
+    const std::vector<uint32_t>& moduleIds) const {
+  if (!m_mappedBundle) {
+    return;
+  }
+
+  static const auto pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+  for (auto id : moduleIds) {
+    if (id >= m_table.numEntries) {
+      continue;
+    }
+    const auto& moduleData = m_table.data[id];
+    const uint32_t length = folly::Endian::little(moduleData.length);
+    if (length == 0) {
+      continue;
+    }
+    auto start = reinterpret_cast<uintptr_t>(mappedData(
+        m_baseOffset + folly::Endian::little(moduleData.offset), length));
+    auto pageStart = start & ~(pageSize - 1);
+    madvise(
+        reinterpret_cast<void*>(pageStart),
+        start + length - pageStart,
+        MADV_WILLNEED);
+  }
+}
+
+const char* JSIndexedRAMBundle::mappedData(size_t position, size_t bytes)
+    const {
+  if (position > m_mappedBundle->size() ||
+      bytes > m_mappedBundle->size() - position) {
+    throw std::ios_base::failure("Unexpected end of RAM Bundle file");
+  }
+  return m_mappedBundle->c_str() + position;
+}
+
 void JSIndexedRAMBundle::readBundle(char* buffer, const std::streamsize bytes)
     const {
+  if (m_mappedBundle) {
+    std::memcpy(
+        buffer,
+        mappedData(m_mappedPosition, static_cast<size_t>(bytes)),
+        static_cast<size_t>(bytes));
+    m_mappedPosition += bytes;
+    return;
+  }
+
   if (!m_bundle->read(buffer, bytes)) {
     if (m_bundle->rdstate() & std::ios::eofbit) {
       throw std::ios_base::failure("Unexpected end of RAM Bundle file");
@@ -118,6 +193,12 @@ void JSIndexedRAMBundle::readBundle(
     char* buffer,
     const std::streamsize bytes,
     const std::ifstream::pos_type position) const {
+  if (m_mappedBundle) {
+    m_mappedPosition = static_cast<size_t>(std::streamoff(position));
+    readBundle(buffer, bytes);
+    return;
+  }
+
   if (!m_bundle->seekg(position)) {
     throw std::ios_base::failure(folly::to<std::string>(
         "Error reading RAM Bundle: ", m_bundle->rdstate()));
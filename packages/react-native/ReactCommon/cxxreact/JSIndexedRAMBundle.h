@@ -9,6 +9,7 @@
 
 #include <istream>
 #include <memory>
+#include <vector>
 
 #include <cxxreact/JSBigString.h>
 #include <cxxreact/JSModulesUnbundle.h>
@@ -23,16 +24,29 @@ class RN_EXPORT JSIndexedRAMBundle : public JSModulesUnbundle {
  public:
   static std::function<std::unique_ptr<JSModulesUnbundle>(std::string)>
   buildFactory();
+  // Same as `buildFactory`, but bundles are memory mapped (see below).
+  static std::function<std::unique_ptr<JSModulesUnbundle>(std::string)>
+  buildMappedFactory();
 
   // Throws std::runtime_error on failure.
   JSIndexedRAMBundle(const char* sourceURL);
   JSIndexedRAMBundle(std::unique_ptr<const JSBigString> script);
+  // Reads the bundle through a memory mapping of the file instead of a
+  // stream: modules are copied straight out of the mapping (no seek and read
+  // syscalls per module) and the startup code is not copied at all.
+  // Throws std::runtime_error on failure.
+  JSIndexedRAMBundle(std::unique_ptr<const JSBigFileString> bundle);
 
   // Throws std::runtime_error on failure.
   std::unique_ptr<const JSBigString> getStartupCode();
   // Throws std::runtime_error on failure.
   Module getModule(uint32_t moduleId) const override;
 
+  // Hints the kernel to page in the code of the given modules ahead of time
+  // (e.g. the modules required during startup). Only has an effect on
+  // memory-mapped bundles.
+  void prefetchModules(const std::vector<uint32_t>& moduleIds) const;
+
  private:
   struct ModuleData {
     uint32_t offset;
@@ -62,10 +76,14 @@ class RN_EXPORT JSIndexedRAMBundle : public JSModulesUnbundle {
       const std::streamsize bytes,
       const std::istream::pos_type position) const;
 
+  const char* mappedData(size_t position, size_t bytes) const;
+
   mutable std::unique_ptr<std::istream> m_bundle;
+  std::unique_ptr<const JSBigFileString> m_mappedBundle;
+  mutable size_t m_mappedPosition{0};
   ModuleTable m_table;
   size_t m_baseOffset;
-  std::unique_ptr<JSBigBufferString> m_startupCode;
+  std::unique_ptr<const JSBigString> m_startupCode;
 };
 
 } // namespace facebook::react
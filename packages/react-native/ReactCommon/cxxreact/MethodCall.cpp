@@ -8,6 +8,9 @@
 #include "MethodCall.h"
 
 #include <folly/json.h>
+#include <algorithm>
+#include <bit>
+#include <cstring>
 #include <stdexcept>
 
 namespace facebook::react {
@@ -63,6 +66,7 @@ std::vector<MethodCall> parseMethodCalls(folly::dynamic&& jsonData) {
   }
 
   std::vector<MethodCall> methodCalls;
+  methodCalls.reserve(moduleIds.size());
   for (size_t i = 0; i < moduleIds.size(); i++) {
     if (!params[i].isArray()) {
       throw std::invalid_argument(folly::to<std::string>(
@@ -84,4 +88,142 @@ std::vector<MethodCall> parseMethodCalls(folly::dynamic&& jsonData) {
   return methodCalls;
 }
 
+namespace {
+
+enum BinaryValueTag : uint8_t {
+  BINARY_NULL = 0,
+  BINARY_FALSE = 1,
+  BINARY_TRUE = 2,
+  BINARY_INT32 = 3,
+  BINARY_DOUBLE = 4,
+  BINARY_STRING = 5,
+  BINARY_ARRAY = 6,
+  BINARY_OBJECT = 7,
+};
+
+class BinaryBatchReader {
+ public:
+  BinaryBatchReader(const uint8_t* data, size_t size)
+      : cursor_(data), end_(data + size) {}
+
+  template <typename T>
+  T read() {
+    ensureAvailable(sizeof(T));
+    uint8_t bytes[sizeof(T)];
+    std::memcpy(bytes, cursor_, sizeof(T));
+    cursor_ += sizeof(T);
+    if constexpr (std::endian::native == std::endian::big) {
+      std::reverse(std::begin(bytes), std::end(bytes));
+    }
+    T value;
+    std::memcpy(&value, bytes, sizeof(T));
+    return value;
+  }
+
+  std::string readString() {
+    auto length = read<uint32_t>();
+    ensureAvailable(length);
+    std::string value(reinterpret_cast<const char*>(cursor_), length);
+    cursor_ += length;
+    return value;
+  }
+
+  folly::dynamic readValue() {
+    auto tag = read<uint8_t>();
+    switch (tag) {
+      case BINARY_NULL:
+        return nullptr;
+      case BINARY_FALSE:
+        return false;
+      case BINARY_TRUE:
+        return true;
+      case BINARY_INT32:
+        // JS numbers are doubles, and that's what native modules get from the
+        // JSON format too (e.g. they call `getDouble()` on them).
+        return static_cast<double>(read<int32_t>());
+      case BINARY_DOUBLE:
+        return read<double>();
+      case BINARY_STRING:
+        return readString();
+      case BINARY_ARRAY:
+        return readArray(read<uint32_t>());
+      case BINARY_OBJECT: {
+        auto count = read<uint32_t>();
+        auto object = folly::dynamic::object();
+        for (uint32_t i = 0; i < count; i++) {
+          auto key = readString();
+          object[std::move(key)] = readValue();
+        }
+        return object;
+      }
+      default:
+        throw std::invalid_argument(folly::to<std::string>(
+            errorPrefix, "unknown binary value tag ", tag));
+    }
+  }
+
+  folly::dynamic readArray(uint32_t count) {
+    // Every value takes at least one byte, so this also guards the reserve
+    // below against corrupted counts.
+    ensureAvailable(count);
+    auto array = folly::dynamic::array();
+    array.reserve(count);
+    for (uint32_t i = 0; i < count; i++) {
+      array.push_back(readValue());
+    }
+    return array;
+  }
+
+  bool atEnd() const {
+    return cursor_ == end_;
+  }
+
+ private:
+  void ensureAvailable(size_t length) const {
+    if (static_cast<size_t>(end_ - cursor_) < length) {
+      throw std::invalid_argument(
+          folly::to<std::string>(errorPrefix, "truncated binary batch"));
+    }
+  }
+
+  const uint8_t* cursor_;
+  const uint8_t* end_;
+};
+
+} // namespace
+
+std::vector<MethodCall> parseMethodCalls(const uint8_t* data, size_t size) {
+  if (size == 0) {
+    return {};
+  }
+
+  BinaryBatchReader reader{data, size};
+  auto callCount = reader.read<uint32_t>();
+  auto callId = reader.read<int32_t>();
+
+  std::vector<MethodCall> methodCalls;
+  methodCalls.reserve(std::min<size_t>(callCount, size));
+  for (uint32_t i = 0; i < callCount; i++) {
+    auto moduleId = reader.read<uint32_t>();
+    auto methodId = reader.read<uint32_t>();
+    auto arguments = reader.readArray(reader.read<uint32_t>());
+
+    methodCalls.emplace_back(
+        static_cast<int>(moduleId),
+        static_cast<int>(methodId),
+        std::move(arguments),
+        callId);
+
+    // only increment callid if contains valid callid as callid is optional
+    callId += (callId != -1) ? 1 : 0;
+  }
+
+  if (!reader.atEnd()) {
+    throw std::invalid_argument(folly::to<std::string>(
+        errorPrefix, "trailing bytes after ", callCount, " calls"));
+  }
+
+  return methodCalls;
+}
+
 } // namespace facebook::react
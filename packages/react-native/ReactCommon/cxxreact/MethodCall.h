@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <map>
 #include <string>
 #include <vector>
@@ -31,4 +33,25 @@ struct MethodCall {
 /// \throws std::invalid_argument
 std::vector<MethodCall> parseMethodCalls(folly::dynamic&& calls);
 
+/*
+ * Decodes a batch of calls encoded in the compact binary format, without going
+ * through an intermediate `folly::dynamic` representation of the whole batch.
+ * All numbers are little-endian, and i32 values are decoded as doubles (like
+ * all the numbers in the JSON format):
+ *
+ *   batch    := u32 callCount, i32 callId (-1 if none), call[callCount]
+ *   call     := u32 moduleId, u32 methodId, u32 argCount, value[argCount]
+ *   value    := u8 tag, payload
+ *     tag 0  := null
+ *     tag 1  := false
+ *     tag 2  := true
+ *     tag 3  := i32
+ *     tag 4  := f64
+ *     tag 5  := u32 byteLength, UTF-8 bytes
+ *     tag 6  := u32 count, value[count]
+ *     tag 7  := u32 count, (u32 byteLength, UTF-8 key bytes, value)[count]
+ */
+/// \throws std::invalid_argument
+std::vector<MethodCall> parseMethodCalls(const uint8_t* data, size_t size);
+
 } // namespace facebook::react
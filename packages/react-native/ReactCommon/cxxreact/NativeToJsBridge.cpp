@@ -11,6 +11,7 @@
 #include <folly/json.h>
 #include <glog/logging.h>
 #include <jsi/jsi.h>
+#include <react/featureflags/ReactNativeFeatureFlags.h>
 #include <reactperflogger/BridgeNativeModulePerfLogger.h>
 
 #include "ErrorUtils.h"
@@ -50,15 +51,22 @@ class JsToNativeBridge : public react::ExecutorDelegate {
   }
 
   void callNativeModules(
-      [[maybe_unused]] JSExecutor& executor,
+      JSExecutor& executor,
       folly::dynamic&& calls,
       bool isEndOfBatch) override {
-    CHECK(m_registry || calls.empty())
+    callNativeModules(
+        executor, parseMethodCalls(std::move(calls)), isEndOfBatch);
+  }
+
+  void callNativeModules(
+      [[maybe_unused]] JSExecutor& executor,
+      std::vector<MethodCall>&& methodCalls,
+      bool isEndOfBatch) override {
+    CHECK(m_registry || methodCalls.empty())
         << "native module calls cannot be completed with no native modules";
     m_batchHadNativeModuleOrTurboModuleCalls =
-        m_batchHadNativeModuleOrTurboModuleCalls || !calls.empty();
+        m_batchHadNativeModuleOrTurboModuleCalls || !methodCalls.empty();
 
-    std::vector<MethodCall> methodCalls = parseMethodCalls(std::move(calls));
     BridgeNativeModulePerfLogger::asyncMethodCallBatchPreprocessEnd(
         (int)methodCalls.size());
 
@@ -147,6 +155,9 @@ void NativeToJsBridge::loadBundle(
           m_applicationScriptHasFailure = true;
           throw;
         }
+        // Feature flags are final once the main bundle has run (see
+        // `ReactInstance::loadScript` for the bridgeless equivalent).
+        ReactNativeFeatureFlags::freeze();
       });
 }
 
@@ -164,6 +175,7 @@ void NativeToJsBridge::loadBundleSync(
     m_applicationScriptHasFailure = true;
     throw;
   }
+  ReactNativeFeatureFlags::freeze();
 }
 
 void NativeToJsBridge::callFunction(
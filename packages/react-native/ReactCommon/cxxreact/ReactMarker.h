@@ -34,7 +34,9 @@ enum ReactMarkerId {
   REGISTER_JS_SEGMENT_START,
   REGISTER_JS_SEGMENT_STOP,
   REACT_INSTANCE_INIT_START,
-  REACT_INSTANCE_INIT_STOP
+  REACT_INSTANCE_INIT_STOP,
+  PREPARE_JS_BUNDLE_START,
+  PREPARE_JS_BUNDLE_STOP
 };
 
 #ifdef __APPLE__
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cxxreact/MethodCall.h>
+#include <folly/dynamic.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace facebook::react {
+
+namespace {
+
+// Mimics a chatty analytics module: every call logs an event name and a small
+// map of string/number attributes.
+constexpr uint32_t kCallsPerBatch = 100;
+
+folly::dynamic makeDynamicBatch() {
+  auto moduleIds = folly::dynamic::array();
+  auto methodIds = folly::dynamic::array();
+  auto params = folly::dynamic::array();
+  for (uint32_t i = 0; i < kCallsPerBatch; i++) {
+    moduleIds.push_back(12);
+    methodIds.push_back(4);
+    params.push_back(folly::dynamic::array(
+        "list_item_impression",
+        folly::dynamic::object("surface", "feed")("position", i)(
+            "visible_percent", 0.75)("is_sponsored", false)));
+  }
+  return folly::dynamic::array(
+      std::move(moduleIds), std::move(methodIds), std::move(params), 1);
+}
+
+template <typename T>
+void write(std::vector<uint8_t>& data, T value) {
+  auto bytes = reinterpret_cast<const uint8_t*>(&value);
+  data.insert(data.end(), bytes, bytes + sizeof(T));
+}
+
+void writeString(std::vector<uint8_t>& data, const std::string& value) {
+  write<uint32_t>(data, static_cast<uint32_t>(value.size()));
+  data.insert(data.end(), value.begin(), value.end());
+}
+
+std::vector<uint8_t> makeBinaryBatch() {
+  std::vector<uint8_t> data;
+  write<uint32_t>(data, kCallsPerBatch);
+  write<int32_t>(data, 1);
+  for (uint32_t i = 0; i < kCallsPerBatch; i++) {
+    write<uint32_t>(data, 12);
+    write<uint32_t>(data, 4);
+    write<uint32_t>(data, 2);
+    write<uint8_t>(data, 5);
+    writeString(data, "list_item_impression");
+    write<uint8_t>(data, 7);
+    write<uint32_t>(data, 4);
+    writeString(data, "surface");
+    write<uint8_t>(data, 5);
+    writeString(data, "feed");
+    writeString(data, "position");
+    write<uint8_t>(data, 3);
+    write<int32_t>(data, static_cast<int32_t>(i));
+    writeString(data, "visible_percent");
+    write<uint8_t>(data, 4);
+    write<double>(data, 0.75);
+    writeString(data, "is_sponsored");
+    write<uint8_t>(data, 1);
+  }
+  return data;
+}
+
+auto dynamicBatch = makeDynamicBatch();
+auto binaryBatch = makeBinaryBatch();
+
+} // namespace
+
+static void parseDynamicMethodCalls(benchmark::State& state) {
+  for (auto _ : state) {
+    // The dynamic batch is consumed by the parser, so the copy stands in for
+    // the JSI -> folly::dynamic conversion that the bridge performs first.
+    auto batch = dynamicBatch;
+    benchmark::DoNotOptimize(parseMethodCalls(std::move(batch)));
+  }
+}
+BENCHMARK(parseDynamicMethodCalls);
+
+static void parseBinaryMethodCalls(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        parseMethodCalls(binaryBatch.data(), binaryBatch.size()));
+  }
+}
+BENCHMARK(parseBinaryMethodCalls);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
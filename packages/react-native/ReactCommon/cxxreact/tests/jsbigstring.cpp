@@ -60,3 +60,17 @@ TEST(JSBigFileString, MapPartTest) {
     EXPECT_EQ(needle[i], bigStr.c_str()[i]);
   }
 }
+
+TEST(JSBigFileString, MapPartBeyondFirstPageTest) {
+  const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  std::string data(pageSize * 2, 'a');
+  std::string needle{"Hello, world"};
+  const off_t offset = pageSize + 10;
+  data.replace(offset, needle.size(), needle);
+
+  int fd = tempFileFromString(data);
+  JSBigFileString bigStr{fd, needle.size(), offset};
+
+  EXPECT_EQ(needle.length(), bigStr.size());
+  EXPECT_EQ(needle, std::string(bigStr.c_str(), bigStr.size()));
+}
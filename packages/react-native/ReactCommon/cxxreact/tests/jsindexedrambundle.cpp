@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cxxreact/JSBigString.h>
+#include <cxxreact/JSIndexedRAMBundle.h>
+#include <gtest/gtest.h>
+
+using namespace facebook::react;
+
+namespace {
+
+void append(std::string& data, uint32_t value) {
+  // RAM bundles are little-endian, like all the platforms we run tests on.
+  data.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+// Builds an indexed RAM bundle with the given startup code and modules. Every
+// code section is stored with a trailing nul byte, as the bundler does. Empty
+// modules are entries without associated code (offset = 0 and length = 0).
+std::string makeRAMBundle(
+    const std::string& startupCode,
+    const std::vector<std::string>& modules) {
+  std::string data;
+  append(data, 0xFB0BD1E5);
+  append(data, static_cast<uint32_t>(modules.size()));
+  append(data, static_cast<uint32_t>(startupCode.size() + 1));
+
+  uint32_t offset = startupCode.size() + 1;
+  for (const auto& module : modules) {
+    if (module.empty()) {
+      append(data, 0);
+      append(data, 0);
+      continue;
+    }
+    append(data, offset);
+    append(data, static_cast<uint32_t>(module.size() + 1));
+    offset += module.size() + 1;
+  }
+
+  data.append(startupCode.c_str(), startupCode.size() + 1);
+  for (const auto& module : modules) {
+    if (!module.empty()) {
+      data.append(module.c_str(), module.size() + 1);
+    }
+  }
+  return data;
+}
+
+// Writes `data` to a temporary file and maps it into `bigString`.
+void mapString(
+    const std::string& data,
+    std::unique_ptr<const JSBigFileString>& bigString) {
+  std::string path = "/tmp/rambundle.XXXXXX";
+  const int fd = mkstemp(path.data());
+  ASSERT_NE(fd, -1);
+  unlink(path.c_str());
+  ASSERT_EQ(
+      write(fd, data.data(), data.size()), static_cast<ssize_t>(data.size()));
+  bigString = std::make_unique<const JSBigFileString>(fd, data.size());
+  close(fd);
+}
+
+} // namespace
+
+TEST(JSIndexedRAMBundle, ReadsModulesFromMappedFile) {
+  // Make the startup code span several pages, so that modules do not start at
+  // a page boundary.
+  std::string startupCode(10000, 'x');
+  auto data = makeRAMBundle(startupCode, {"module0", "", "module2"});
+
+  std::unique_ptr<const JSBigFileString> mappedData;
+  ASSERT_NO_FATAL_FAILURE(mapString(data, mappedData));
+  JSIndexedRAMBundle bundle{std::move(mappedData)};
+
+  auto startup = bundle.getStartupCode();
+  EXPECT_EQ(startupCode, std::string(startup->c_str(), startup->size()));
+
+  auto module0 = bundle.getModule(0);
+  EXPECT_EQ("0.js", module0.name);
+  EXPECT_EQ("module0", module0.code);
+  EXPECT_EQ("module2", bundle.getModule(2).code);
+
+  // Entries without associated code, and out of range ones.
+  EXPECT_THROW(bundle.getModule(1), std::ios_base::failure);
+  EXPECT_THROW(bundle.getModule(3), std::ios_base::failure);
+}
+
+TEST(JSIndexedRAMBundle, MappedFileMatchesStream) {
+  auto data = makeRAMBundle("startup", {"a", "bb", "ccc"});
+
+  std::unique_ptr<const JSBigFileString> mappedData;
+  ASSERT_NO_FATAL_FAILURE(mapString(data, mappedData));
+  JSIndexedRAMBundle mappedBundle{std::move(mappedData)};
+  JSIndexedRAMBundle streamBundle{
+      std::make_unique<JSBigStdString>(std::move(data))};
+
+  EXPECT_STREQ(
+      streamBundle.getStartupCode()->c_str(),
+      mappedBundle.getStartupCode()->c_str());
+  for (uint32_t id = 0; id < 3; id++) {
+    EXPECT_EQ(streamBundle.getModule(id).code, mappedBundle.getModule(id).code);
+  }
+}
+
+TEST(JSIndexedRAMBundle, TruncatedMappedFileThrows) {
+  auto data = makeRAMBundle("startup", {"module0"});
+  data.resize(data.size() - 4);
+
+  std::unique_ptr<const JSBigFileString> mappedData;
+  ASSERT_NO_FATAL_FAILURE(mapString(data, mappedData));
+  EXPECT_THROW(
+      {
+        JSIndexedRAMBundle bundle{std::move(mappedData)};
+        bundle.getModule(0);
+      },
+      std::ios_base::failure);
+}
+
+TEST(JSIndexedRAMBundle, PrefetchesMappedModules) {
+  std::string startupCode(10000, 'x');
+  auto data = makeRAMBundle(startupCode, {"module0", "", "module2"});
+
+  std::unique_ptr<const JSBigFileString> mappedData;
+  ASSERT_NO_FATAL_FAILURE(mapString(data, mappedData));
+  JSIndexedRAMBundle bundle{std::move(mappedData)};
+
+  // Entries without associated code and out of range ones are skipped.
+  bundle.prefetchModules({0, 1, 2, 42});
+
+  EXPECT_EQ("module0", bundle.getModule(0).code);
+  EXPECT_EQ("module2", bundle.getModule(2).code);
+  EXPECT_THROW(bundle.getModule(1), std::ios_base::failure);
+}
+
+TEST(JSIndexedRAMBundle, PrefetchIsNoOpForStreams) {
+  JSIndexedRAMBundle bundle{std::make_unique<JSBigStdString>(
+      makeRAMBundle("startup", {"module0"}))};
+
+  bundle.prefetchModules({0});
+
+  EXPECT_EQ("module0", bundle.getModule(0).code);
+}
@@ -5,7 +5,10 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <cxxreact/JSBigString.h>
+#include <cxxreact/JSExecutor.h>
 #include <cxxreact/MethodCall.h>
+#include <cxxreact/RAMBundleRegistry.h>
 
 #include <folly/json.h>
 #pragma GCC diagnostic push
@@ -16,6 +19,83 @@
 using namespace facebook::react;
 using dynamic = folly::dynamic;
 
+namespace {
+
+// Writes values in the host byte order, which is little-endian on all the
+// platforms the tests run on.
+class BinaryBatchBuilder {
+ public:
+  template <typename T>
+  BinaryBatchBuilder& write(T value) {
+    auto bytes = reinterpret_cast<const uint8_t*>(&value);
+    data.insert(data.end(), bytes, bytes + sizeof(T));
+    return *this;
+  }
+
+  BinaryBatchBuilder& writeString(const std::string& value) {
+    write<uint32_t>(static_cast<uint32_t>(value.size()));
+    data.insert(data.end(), value.begin(), value.end());
+    return *this;
+  }
+
+  std::vector<uint8_t> data;
+};
+
+class NullExecutor : public JSExecutor {
+ public:
+  void initializeRuntime() override {}
+  void loadBundle(
+      std::unique_ptr<const JSBigString> /*script*/,
+      std::string /*sourceURL*/) override {}
+  void setBundleRegistry(
+      std::unique_ptr<RAMBundleRegistry> /*bundleRegistry*/) override {}
+  void registerBundle(
+      uint32_t /*bundleId*/,
+      const std::string& /*bundlePath*/) override {}
+  void callFunction(
+      const std::string& /*moduleId*/,
+      const std::string& /*methodId*/,
+      const folly::dynamic& /*arguments*/) override {}
+  void invokeCallback(
+      const double /*callbackId*/,
+      const folly::dynamic& /*arguments*/) override {}
+  void setGlobalVariable(
+      std::string /*propName*/,
+      std::unique_ptr<const JSBigString> /*jsonValue*/) override {}
+  std::string getDescription() override {
+    return "NullExecutor";
+  }
+};
+
+// A delegate which only implements the `folly::dynamic` overload of
+// `callNativeModules`, like delegates written before the binary format.
+class DynamicOnlyDelegate : public ExecutorDelegate {
+ public:
+  std::shared_ptr<ModuleRegistry> getModuleRegistry() override {
+    return nullptr;
+  }
+  void callNativeModules(
+      JSExecutor& /*executor*/,
+      folly::dynamic&& calls,
+      bool isEndOfBatch) override {
+    receivedCalls = std::move(calls);
+    receivedIsEndOfBatch = isEndOfBatch;
+  }
+  using ExecutorDelegate::callNativeModules;
+  MethodCallResult callSerializableNativeHook(
+      JSExecutor& /*executor*/,
+      unsigned int /*moduleId*/,
+      unsigned int /*methodId*/,
+      folly::dynamic&& /*args*/) override {
+    return std::nullopt;
+  }
+
+  folly::dynamic receivedCalls;
+  bool receivedIsEndOfBatch{false};
+};
+
+} // namespace
+
 TEST(parseMethodCalls, SingleReturnCallNoArgs) {
   auto jsText = "[[7],[3],[[]]]";
   auto returnedCalls = parseMethodCalls(folly::parseJson(jsText));
@@ -153,3 +233,102 @@ TEST(parseMethodCalls, ParseTwoCalls) {
   auto returnedCalls = parseMethodCalls(folly::parseJson(jsText));
   EXPECT_EQ(2, returnedCalls.size());
 }
+
+TEST(parseMethodCalls, BinaryEmptyBatch) {
+  auto returnedCalls = parseMethodCalls(nullptr, 0);
+  EXPECT_EQ(0, returnedCalls.size());
+}
+
+TEST(parseMethodCalls, BinaryCallWithArgs) {
+  BinaryBatchBuilder builder;
+  builder.write<uint32_t>(2).write<int32_t>(5);
+  // moduleId 7, methodId 3: ("foo", 14, null, false)
+  builder.write<uint32_t>(7).write<uint32_t>(3).write<uint32_t>(4);
+  builder.write<uint8_t>(5).writeString("foo");
+  builder.write<uint8_t>(3).write<int32_t>(14);
+  builder.write<uint8_t>(0);
+  builder.write<uint8_t>(1);
+  // moduleId 1, methodId 2: ({"bar": 4.0, "baz": [true]})
+  builder.write<uint32_t>(1).write<uint32_t>(2).write<uint32_t>(1);
+  builder.write<uint8_t>(7).write<uint32_t>(2);
+  builder.writeString("bar").write<uint8_t>(4).write<double>(4.0);
+  builder.writeString("baz").write<uint8_t>(6).write<uint32_t>(1);
+  builder.write<uint8_t>(2);
+
+  auto returnedCalls =
+      parseMethodCalls(builder.data.data(), builder.data.size());
+  EXPECT_EQ(2, returnedCalls.size());
+
+  EXPECT_EQ(7, returnedCalls[0].moduleId);
+  EXPECT_EQ(3, returnedCalls[0].methodId);
+  EXPECT_EQ(5, returnedCalls[0].callId);
+  EXPECT_EQ(
+      dynamic::array("foo", 14, nullptr, false), returnedCalls[0].arguments);
+  EXPECT_TRUE(returnedCalls[0].arguments[1].isDouble());
+
+  EXPECT_EQ(1, returnedCalls[1].moduleId);
+  EXPECT_EQ(2, returnedCalls[1].methodId);
+  EXPECT_EQ(6, returnedCalls[1].callId);
+  EXPECT_EQ(
+      dynamic::array(
+          dynamic::object("bar", 4.0)("baz", dynamic::array(true))),
+      returnedCalls[1].arguments);
+}
+
+TEST(parseMethodCalls, BinaryInvalidInput) {
+  {
+    // Truncated header
+    BinaryBatchBuilder builder;
+    builder.write<uint32_t>(1);
+    EXPECT_THROW(
+        parseMethodCalls(builder.data.data(), builder.data.size()),
+        std::invalid_argument);
+  }
+  {
+    // Missing call
+    BinaryBatchBuilder builder;
+    builder.write<uint32_t>(1).write<int32_t>(-1);
+    EXPECT_THROW(
+        parseMethodCalls(builder.data.data(), builder.data.size()),
+        std::invalid_argument);
+  }
+  {
+    // Unknown tag
+    BinaryBatchBuilder builder;
+    builder.write<uint32_t>(1).write<int32_t>(-1);
+    builder.write<uint32_t>(0).write<uint32_t>(0).write<uint32_t>(1);
+    builder.write<uint8_t>(42);
+    EXPECT_THROW(
+        parseMethodCalls(builder.data.data(), builder.data.size()),
+        std::invalid_argument);
+  }
+  {
+    // Trailing bytes
+    BinaryBatchBuilder builder;
+    builder.write<uint32_t>(0).write<int32_t>(-1).write<uint8_t>(0);
+    EXPECT_THROW(
+        parseMethodCalls(builder.data.data(), builder.data.size()),
+        std::invalid_argument);
+  }
+}
+
+TEST(parseMethodCalls, DecodedCallsAreForwardedAsDynamic) {
+  NullExecutor executor;
+  DynamicOnlyDelegate delegate;
+
+  std::vector<MethodCall> calls;
+  calls.emplace_back(1, 2, dynamic::array(3, "four"), 5);
+  calls.emplace_back(6, 7, dynamic::array(), 6);
+  delegate.callNativeModules(executor, std::move(calls), true);
+
+  EXPECT_TRUE(delegate.receivedIsEndOfBatch);
+  auto parsed = parseMethodCalls(std::move(delegate.receivedCalls));
+  ASSERT_EQ(parsed.size(), 2);
+  EXPECT_EQ(parsed[0].moduleId, 1);
+  EXPECT_EQ(parsed[0].methodId, 2);
+  EXPECT_EQ(parsed[0].arguments, dynamic::array(3, "four"));
+  EXPECT_EQ(parsed[0].callId, 5);
+  EXPECT_EQ(parsed[1].moduleId, 6);
+  EXPECT_EQ(parsed[1].methodId, 7);
+  EXPECT_EQ(parsed[1].callId, 6);
+}
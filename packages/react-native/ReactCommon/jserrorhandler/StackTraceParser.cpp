@@ -6,26 +6,242 @@
  */
 
 #include "StackTraceParser.h"
-#include <glog/logging.h>
+#include <algorithm>
+#include <array>
+#include <cctype>
 #include <charconv>
 #include <optional>
-#include <regex>
-#include <sstream>
 #include <string>
+#include <string_view>
 
 using namespace facebook::react;
 
 const std::string UNKNOWN_FUNCTION = "<unknown>";
 
-// TODO(T198763073): Migrate away from std::regex in this file
-// @lint-ignore-every CLANGTIDY facebook-hte-StdRegexIsAwful
-
 /**
- * Stack trace parsing for other jsvms:
- * Port of https://github.com/errwischt/stacktrace-parser
+ * The parsers below are hand-written equivalents of the regular expressions
+ * quoted above each of them: every parser yields the same captures as the
+ * first match of its (ECMAScript) regular expression would, without
+ * constructing or running `std::regex`.
  */
 namespace {
 
+constexpr auto npos = std::string_view::npos;
+
+// `\s` and `\d` of ECMAScript regular expressions.
+bool isSpace(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' ||
+      c == '\r';
+}
+
+bool isDigit(char c) {
+  return c >= '0' && c <= '9';
+}
+
+// `.` doesn't match line terminators.
+bool hasLineTerminator(std::string_view text) {
+  return text.find_first_of("\r\n") != npos;
+}
+
+bool hasPrefixAt(std::string_view text, size_t pos, std::string_view prefix) {
+  return pos <= text.size() && text.substr(pos, prefix.size()) == prefix;
+}
+
+// `prefix` must be lowercase.
+bool hasPrefixAtIgnoringCase(
+    std::string_view text,
+    size_t pos,
+    std::string_view prefix) {
+  if (pos > text.size() || text.size() - pos < prefix.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < prefix.size(); i++) {
+    if (std::tolower(static_cast<unsigned char>(text[pos + i])) != prefix[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+size_t skipSpaces(std::string_view text, size_t pos) {
+  while (pos < text.size() && isSpace(text[pos])) {
+    pos++;
+  }
+  return pos;
+}
+
+size_t skipNonSpaces(std::string_view text, size_t pos) {
+  while (pos < text.size() && !isSpace(text[pos])) {
+    pos++;
+  }
+  return pos;
+}
+
+size_t skipDigits(std::string_view text, size_t pos) {
+  while (pos < text.size() && isDigit(text[pos])) {
+    pos++;
+  }
+  return pos;
+}
+
+// Every regular expression below ends with `\s*$`.
+std::string_view trimTrailingSpaces(std::string_view text) {
+  size_t end = text.size();
+  while (end > 0 && isSpace(text[end - 1])) {
+    end--;
+  }
+  return text.substr(0, end);
+}
+
+// Returns the position of `:` in `:\d+` ending at `end`, or `npos`.
+size_t findNumberColon(std::string_view text, size_t end) {
+  size_t begin = end;
+  while (begin > 0 && isDigit(text[begin - 1])) {
+    begin--;
+  }
+  if (begin == end || begin == 0 || text[begin - 1] != ':') {
+    return npos;
+  }
+  return begin - 1;
+}
+
+/*
+ * A possible end of the file name of a frame and the line and column
+ * numbers which follow it.
+ */
+struct Location {
+  size_t fileEnd;
+  std::string_view lineNumber;
+  std::string_view column;
+};
+
+/*
+ * All positions, in increasing order, at which a lazily matched file name can
+ * end given that the line continues with `:(\d+)(?::(\d+))?` (or with
+ * `(?::(\d+))?(?::(\d+))?` unless `isLineNumberRequired`) and ends at `end`,
+ * optionally followed by a single character (a closing paren).
+ */
+struct Locations {
+  std::array<Location, 4> items;
+  size_t size{0};
+
+  std::optional<Location> findFirst(size_t minFileEnd) const {
+    for (size_t i = 0; i < size; i++) {
+      if (items[i].fileEnd >= minFileEnd) {
+        return items[i];
+      }
+    }
+    return std::nullopt;
+  }
+};
+
+Locations findLocations(
+    std::string_view line,
+    size_t end,
+    bool isLineNumberRequired) {
+  Locations locations;
+  auto add = [&](size_t fileEnd,
+                 std::string_view lineNumber,
+                 std::string_view column) {
+    locations.items[locations.size++] = {fileEnd, lineNumber, column};
+  };
+  auto numberAfter = [&](size_t colon, size_t numberEnd) {
+    return line.substr(colon + 1, numberEnd - colon - 1);
+  };
+
+  size_t lastColon = findNumberColon(line, end);
+  if (lastColon != npos) {
+    size_t firstColon = findNumberColon(line, lastColon);
+    if (firstColon != npos) {
+      add(firstColon,
+          numberAfter(firstColon, lastColon),
+          numberAfter(lastColon, end));
+    }
+    add(lastColon, numberAfter(lastColon, end), {});
+  }
+  if (!isLineNumberRequired) {
+    add(end, {}, {});
+    if (end != line.size()) {
+      add(line.size(), {}, {});
+    }
+  }
+  return locations;
+}
+
+// Strips a closing paren matched by a trailing `\)?`.
+size_t endBeforeClosingParen(std::string_view line) {
+  return !line.empty() && line.back() == ')' ? line.size() - 1 : line.size();
+}
+
+/*
+ * Returns the length of the `prefixes` entry (or of a `[a-z]:\\` drive if
+ * `allowsDrive`) which `line` contains at `pos`, or 0.
+ */
+template <size_t N>
+size_t matchFilePrefix(
+    std::string_view line,
+    size_t pos,
+    const std::array<std::string_view, N>& prefixes,
+    bool allowsDrive = false) {
+  for (auto prefix : prefixes) {
+    if (hasPrefixAtIgnoringCase(line, pos, prefix)) {
+      return prefix.size();
+    }
+  }
+  if (allowsDrive && pos + 2 < line.size() &&
+      std::isalpha(static_cast<unsigned char>(line[pos])) &&
+      line[pos + 1] == ':' && line[pos + 2] == '\\') {
+    return 3;
+  }
+  return 0;
+}
+
+constexpr std::array<std::string_view, 11> CHROME_FILE_PREFIXES = {
+    "file",
+    "https",
+    "http",
+    "blob",
+    "chrome-extension",
+    "native",
+    "eval",
+    "webpack",
+    "<anonymous>",
+    "/",
+    "\\\\"};
+
+constexpr std::array<std::string_view, 6> WINJS_FILE_PREFIXES = {
+    "file:", "ms-appx:", "https:", "http:", "webpack:", "blob:"};
+
+constexpr std::array<std::string_view, 8> GECKO_FILE_PREFIXES = {
+    "file",
+    "https",
+    "http",
+    "blob",
+    "chrome",
+    "webpack",
+    "resource",
+    "[native"};
+
+struct Frame {
+  std::string_view methodName;
+  std::string_view file;
+  std::string_view lineNumber;
+  std::string_view column;
+};
+
+Frame makeFrame(
+    std::string_view line,
+    size_t methodBegin,
+    size_t methodEnd,
+    size_t fileBegin,
+    const Location& location) {
+  return {
+      line.substr(methodBegin, methodEnd - methodBegin),
+      line.substr(fileBegin, location.fileEnd - fileBegin),
+      location.lineNumber,
+      location.column};
+}
+
 std::optional<int> toInt(std::string_view input) {
   int out;
   const std::from_chars_result result =
@@ -51,125 +267,343 @@ JsErrorHandler::ParsedError::StackFrame parseStackFrame(
   return frame;
 }
 
+/**
+ * Stack trace parsing for other jsvms:
+ * Port of https://github.com/errwischt/stacktrace-parser
+ */
+
+// \((\S*)(?::(\d+))(?::(\d+))\)
+bool searchChromeEval(std::string_view file, Frame& frame) {
+  for (size_t open = file.find('('); open != npos;
+       open = file.find('(', open + 1)) {
+    size_t end = skipNonSpaces(file, open + 1);
+    // The longest `\S*` followed by `:<line>:<column>)`.
+    for (size_t pos = end; pos-- > open + 1;) {
+      if (file[pos] != ':') {
+        continue;
+      }
+      size_t lineEnd = skipDigits(file, pos + 1);
+      if (lineEnd == pos + 1 || !hasPrefixAt(file, lineEnd, ":")) {
+        continue;
+      }
+      size_t columnEnd = skipDigits(file, lineEnd + 1);
+      if (columnEnd == lineEnd + 1 || !hasPrefixAt(file, columnEnd, ")")) {
+        continue;
+      }
+      frame.file = file.substr(open + 1, pos - open - 1);
+      frame.lineNumber = file.substr(pos + 1, lineEnd - pos - 1);
+      frame.column = file.substr(lineEnd + 1, columnEnd - lineEnd - 1);
+      return true;
+    }
+  }
+  return false;
+}
+
+// ^\s*at (.*?) ?\(((?:file|https?|blob|chrome-extension|native|eval|webpack|<anonymous>|\/|[a-z]:\\|\\\\).*?)(?::(\d+))?(?::(\d+))?\)?\s*$
+// (case-insensitive)
 std::optional<JsErrorHandler::ParsedError::StackFrame> parseChrome(
-    const std::string& line) {
-  static const std::regex chromeRe(
-      R"(^\s*at (.*?) ?\(((?:file|https?|blob|chrome-extension|native|eval|webpack|<anonymous>|\/|[a-z]:\\|\\\\).*?)(?::(\d+))?(?::(\d+))?\)?\s*$)",
-      std::regex::icase);
-  static const std::regex chromeEvalRe(R"(\((\S*)(?::(\d+))(?::(\d+))\))");
-  std::smatch match;
-
-  if (!std::regex_match(line, match, chromeRe)) {
+    std::string_view line) {
+  size_t methodBegin = skipSpaces(line, 0);
+  if (!hasPrefixAtIgnoringCase(line, methodBegin, "at ") ||
+      hasLineTerminator(line.substr(methodBegin))) {
     return std::nullopt;
   }
-  std::string methodName = match[1].str();
-  std::string file = match[2].str();
-  std::string lineStr = match[3].str();
-  std::string columnStr = match[4].str();
-
-  bool isNative = std::regex_search(file, std::regex("^native"));
-  bool isEval = std::regex_search(file, std::regex("^eval"));
-  std::string evalFile;
-  std::string evalLine;
-  std::string evalColumn;
-  if (isEval && std::regex_search(file, match, chromeEvalRe)) {
-    evalFile = match[1].str();
-    evalLine = match[2].str();
-    evalColumn = match[3].str();
-    file = evalFile;
-    lineStr = evalLine;
-    columnStr = evalColumn;
-  }
-  std::string actualFile = !isNative ? file : "";
-  return parseStackFrame(actualFile, methodName, lineStr, columnStr);
+  methodBegin += 3;
+
+  // The method name ends at the first paren which opens a known file name;
+  // the rest of the line always matches then.
+  size_t fileBegin = npos;
+  size_t prefixLength = 0;
+  for (size_t open = line.find('(', methodBegin); open != npos;
+       open = line.find('(', open + 1)) {
+    prefixLength =
+        matchFilePrefix(line, open + 1, CHROME_FILE_PREFIXES, true);
+    if (prefixLength > 0) {
+      fileBegin = open + 1;
+      break;
+    }
+  }
+  if (fileBegin == npos) {
+    return std::nullopt;
+  }
+  size_t methodEnd = fileBegin - 1;
+  if (methodEnd > methodBegin && line[methodEnd - 1] == ' ') {
+    methodEnd--;
+  }
+  auto location =
+      findLocations(line, endBeforeClosingParen(line), false)
+          .findFirst(fileBegin + prefixLength);
+  auto frame = makeFrame(line, methodBegin, methodEnd, fileBegin, *location);
+
+  bool isNative = hasPrefixAt(frame.file, 0, "native");
+  bool isEval = hasPrefixAt(frame.file, 0, "eval");
+  if (isEval) {
+    searchChromeEval(frame.file, frame);
+  }
+  if (isNative) {
+    frame.file = {};
+  }
+  return parseStackFrame(
+      frame.file, frame.methodName, frame.lineNumber, frame.column);
 }
 
+// ^\s*at (?:((?:\[object object\])?.+) )?\(?((?:file|ms-appx|https?|webpack|blob):.*?):(\d+)(?::(\d+))?\)?\s*$
+// (case-insensitive)
 std::optional<JsErrorHandler::ParsedError::StackFrame> parseWinjs(
-    const std::string& line) {
-  static const std::regex winjsRe(
-      R"(^\s*at (?:((?:\[object object\])?.+) )?\(?((?:file|ms-appx|https?|webpack|blob):.*?):(\d+)(?::(\d+))?\)?\s*$)",
-      std::regex::icase);
-  std::smatch match;
-  if (!std::regex_match(line, match, winjsRe)) {
+    std::string_view line) {
+  size_t methodBegin = skipSpaces(line, 0);
+  if (!hasPrefixAtIgnoringCase(line, methodBegin, "at ") ||
+      hasLineTerminator(line.substr(methodBegin))) {
     return std::nullopt;
   }
-  std::string methodName = match[1].str();
-  std::string file = match[2].str();
-  std::string lineStr = match[3].str();
-  std::string columnStr = match[4].str();
-  return parseStackFrame(file, methodName, lineStr, columnStr);
+  methodBegin += 3;
+
+  auto locations = findLocations(line, endBeforeClosingParen(line), true);
+  auto matchFile = [&](size_t methodEnd, size_t pos) -> std::optional<Frame> {
+    if (hasPrefixAt(line, pos, "(")) {
+      pos++;
+    }
+    size_t prefixLength = matchFilePrefix(line, pos, WINJS_FILE_PREFIXES);
+    if (prefixLength == 0) {
+      return std::nullopt;
+    }
+    auto location = locations.findFirst(pos + prefixLength);
+    if (!location) {
+      return std::nullopt;
+    }
+    return makeFrame(line, methodBegin, methodEnd, pos, *location);
+  };
+
+  // The method name is the longest one followed by a space and a file name.
+  std::optional<Frame> frame;
+  for (size_t pos = line.size(); !frame && pos-- > methodBegin + 1;) {
+    if (line[pos] == ' ') {
+      frame = matchFile(pos, pos + 1);
+    }
+  }
+  if (!frame) {
+    frame = matchFile(methodBegin, methodBegin);
+  }
+  if (!frame) {
+    return std::nullopt;
+  }
+  return parseStackFrame(
+      frame->file, frame->methodName, frame->lineNumber, frame->column);
+}
+
+// (\S+) line (\d+)(?: > eval line \d+)* > eval
+// (case-insensitive)
+bool searchGeckoEval(std::string_view file, Frame& frame) {
+  for (size_t pos = skipSpaces(file, 0); pos < file.size();
+       pos = skipSpaces(file, pos)) {
+    size_t end = skipNonSpaces(file, pos);
+    if (hasPrefixAtIgnoringCase(file, end, " line ")) {
+      size_t lineEnd = skipDigits(file, end + 6);
+      if (lineEnd > end + 6 &&
+          hasPrefixAtIgnoringCase(file, lineEnd, " > eval")) {
+        frame.file = file.substr(pos, end - pos);
+        frame.lineNumber = file.substr(end + 6, lineEnd - end - 6);
+        return true;
+      }
+    }
+    pos = end;
+  }
+  return false;
 }
 
+// ^\s*(.*?)(?:\((.*?)\))?(?:^|@)((?:file|https?|blob|chrome|webpack|resource|\[native).*?|[^@]*bundle)(?::(\d+))?(?::(\d+))?\s*$
+// (case-insensitive)
 std::optional<JsErrorHandler::ParsedError::StackFrame> parseGecko(
-    const std::string& line) {
-  static const std::regex geckoRe(
-      R"(^\s*(.*?)(?:\((.*?)\))?(?:^|@)((?:file|https?|blob|chrome|webpack|resource|\[native).*?|[^@]*bundle)(?::(\d+))?(?::(\d+))?\s*$)",
-      std::regex::icase);
-  static const std::regex geckoEvalRe(
-      R"((\S+) line (\d+)(?: > eval line \d+)* > eval)", std::regex::icase);
-  std::smatch match;
-  if (!std::regex_match(line, match, geckoRe)) {
+    std::string_view line) {
+  auto locations = findLocations(line, line.size(), false);
+  auto matchFile = [&](size_t methodBegin,
+                       size_t methodEnd,
+                       size_t pos) -> std::optional<Frame> {
+    size_t prefixLength = matchFilePrefix(line, pos, GECKO_FILE_PREFIXES);
+    if (prefixLength > 0) {
+      auto location = locations.findFirst(pos + prefixLength);
+      if (!hasLineTerminator(line.substr(pos, location->fileEnd - pos))) {
+        return makeFrame(line, methodBegin, methodEnd, pos, *location);
+      }
+    }
+    // `[^@]*bundle`, as long as possible.
+    if (line.find('@', pos) != npos) {
+      return std::nullopt;
+    }
+    for (size_t i = locations.size; i-- > 0;) {
+      size_t fileEnd = locations.items[i].fileEnd;
+      if (fileEnd >= pos + 6 &&
+          hasPrefixAtIgnoringCase(line, fileEnd - 6, "bundle")) {
+        return makeFrame(
+            line, methodBegin, methodEnd, pos, locations.items[i]);
+      }
+    }
     return std::nullopt;
+  };
+
+  // The method name is the shortest one followed by an optional `(...)`
+  // and `@` (or nothing) and a file name.
+  const size_t methodBegin = skipSpaces(line, 0);
+  const size_t methodLimit =
+      std::min(line.size(), line.find_first_of("\r\n", methodBegin));
+  std::optional<Frame> frame;
+  for (size_t pos = methodBegin; !frame && pos < methodLimit + 1; pos++) {
+    if (pos < line.size() && line[pos] == '(') {
+      for (size_t close = line.find(')', pos + 1); !frame && close != npos;
+           close = line.find(')', close + 1)) {
+        if (hasLineTerminator(line.substr(pos + 1, close - pos - 1))) {
+          break;
+        }
+        if (hasPrefixAt(line, close + 1, "@")) {
+          frame = matchFile(methodBegin, pos, close + 2);
+        }
+      }
+    }
+    if (!frame && pos == 0) {
+      frame = matchFile(0, 0, 0);
+    }
+    if (!frame && hasPrefixAt(line, pos, "@")) {
+      frame = matchFile(methodBegin, pos, pos + 1);
+    }
+  }
+  if (!frame && methodBegin > 0) {
+    // The file name starts at `^`, including the leading spaces.
+    frame = matchFile(0, 0, 0);
+  }
+  if (!frame) {
+    return std::nullopt;
+  }
+
+  bool isEval = frame->file.find(" > eval") != npos;
+  if (isEval && searchGeckoEval(frame->file, *frame)) {
+    frame->column = {}; // No column number in eval
   }
-  std::string methodName = match[1].str();
-  std::string tmpStr = match[2].str();
-  std::string file = match[3].str();
-  std::string lineStr = match[4].str();
-  std::string columnStr = match[5].str();
-  bool isEval = std::regex_search(file, std::regex(" > eval"));
-  std::string evalFile;
-  std::string evalLine;
-  if (isEval && std::regex_search(file, match, geckoEvalRe)) {
-    evalFile = match[1].str();
-    evalLine = match[2].str();
-    file = evalFile;
-    lineStr = evalLine;
-    columnStr = ""; // No column number in eval
-  }
-  return parseStackFrame(file, methodName, lineStr, columnStr);
+  return parseStackFrame(
+      frame->file, frame->methodName, frame->lineNumber, frame->column);
 }
 
+// ^\s*(?:([^@]*)(?:\((.*?)\))?@)?(\S.*?):(\d+)(?::(\d+))?\s*$
+// (case-insensitive)
 std::optional<JsErrorHandler::ParsedError::StackFrame> parseJSC(
-    const std::string& line) {
-  static const std::regex javaScriptCoreRe(
-      R"(^\s*(?:([^@]*)(?:\((.*?)\))?@)?(\S.*?):(\d+)(?::(\d+))?\s*$)",
-      std::regex::icase);
-  std::smatch match;
-  if (!std::regex_match(line, match, javaScriptCoreRe)) {
+    std::string_view line) {
+  auto locations = findLocations(line, line.size(), true);
+  const size_t methodBegin = skipSpaces(line, 0);
+  auto matchFile = [&](size_t methodEnd, size_t pos) -> std::optional<Frame> {
+    if (pos >= line.size() || isSpace(line[pos])) {
+      return std::nullopt;
+    }
+    auto location = locations.findFirst(pos + 1);
+    if (!location ||
+        hasLineTerminator(line.substr(pos, location->fileEnd - pos))) {
+      return std::nullopt;
+    }
+    return makeFrame(line, methodBegin, methodEnd, pos, *location);
+  };
+
+  // The method name is the longest one without `@` followed by an optional
+  // `(...)` and `@`.
+  std::optional<Frame> frame;
+  size_t methodEnd = std::min(line.size(), line.find('@', methodBegin));
+  for (size_t pos = methodEnd + 1; !frame && pos-- > methodBegin;) {
+    if (hasPrefixAt(line, pos, "(")) {
+      for (size_t close = line.find(')', pos + 1); !frame && close != npos;
+           close = line.find(')', close + 1)) {
+        if (hasLineTerminator(line.substr(pos + 1, close - pos - 1))) {
+          break;
+        }
+        if (hasPrefixAt(line, close + 1, "@")) {
+          frame = matchFile(pos, close + 2);
+        }
+      }
+    }
+    if (!frame && hasPrefixAt(line, pos, "@")) {
+      frame = matchFile(pos, pos + 1);
+    }
+  }
+  if (!frame) {
+    frame = matchFile(methodBegin, methodBegin);
+  }
+  if (!frame) {
     return std::nullopt;
   }
-  std::string methodName = match[1].str();
-  std::string tmpStr =
-      match[2].str(); // This captures any string within parentheses if present
-  std::string file = match[3].str();
-  std::string lineStr = match[4].str();
-  std::string columnStr = match[5].str();
-  return parseStackFrame(file, methodName, lineStr, columnStr);
+  return parseStackFrame(
+      frame->file, frame->methodName, frame->lineNumber, frame->column);
 }
 
+// ^\s*at (?:((?:\[object object\])?[^\\/]+(?: \[as \S+\])?) )?\(?(.*?):(\d+)(?::(\d+))?\)?\s*$
+// (case-insensitive)
 std::optional<JsErrorHandler::ParsedError::StackFrame> parseNode(
-    const std::string& line) {
-  static const std::regex nodeRe(
-      R"(^\s*at (?:((?:\[object object\])?[^\\/]+(?: \[as \S+\])?) )?\(?(.*?):(\d+)(?::(\d+))?\)?\s*$)",
-      std::regex::icase);
-  std::smatch match;
-  if (!std::regex_match(line, match, nodeRe)) {
+    std::string_view line) {
+  size_t methodBegin = skipSpaces(line, 0);
+  if (!hasPrefixAtIgnoringCase(line, methodBegin, "at ")) {
     return std::nullopt;
   }
-  std::string methodName = match[1].str();
-  std::string file = match[2].str();
-  std::string lineStr = match[3].str();
-  std::string columnStr = match[4].str();
-  return parseStackFrame(file, methodName, lineStr, columnStr);
+  methodBegin += 3;
+
+  auto locations = findLocations(line, endBeforeClosingParen(line), true);
+  auto matchFile = [&](size_t methodEnd, size_t pos) -> std::optional<Frame> {
+    if (hasPrefixAt(line, pos, "(")) {
+      pos++;
+    }
+    auto location = locations.findFirst(pos);
+    if (!location || hasLineTerminator(line.substr(pos))) {
+      return std::nullopt;
+    }
+    return makeFrame(line, methodBegin, methodEnd, pos, *location);
+  };
+
+  // `[^\\/]+(?: \[as \S+\])? ` starting at `nameBegin`, trying the longest
+  // names first.
+  auto matchMethod = [&](size_t nameBegin) -> std::optional<Frame> {
+    size_t nameEnd =
+        std::min(line.size(), line.find_first_of("\\/", nameBegin));
+    for (size_t pos = nameEnd; pos > nameBegin; pos--) {
+      if (hasPrefixAtIgnoringCase(line, pos, " [as ")) {
+        size_t aliasEnd = skipNonSpaces(line, pos + 5);
+        if (aliasEnd >= pos + 7 && line[aliasEnd - 1] == ']' &&
+            hasPrefixAt(line, aliasEnd, " ")) {
+          if (auto frame = matchFile(aliasEnd, aliasEnd + 1)) {
+            return frame;
+          }
+        }
+      }
+      if (hasPrefixAt(line, pos, " ")) {
+        if (auto frame = matchFile(pos, pos + 1)) {
+          return frame;
+        }
+      }
+    }
+    return std::nullopt;
+  };
+
+  std::optional<Frame> frame;
+  if (hasPrefixAtIgnoringCase(line, methodBegin, "[object object]")) {
+    frame = matchMethod(methodBegin + 15);
+  }
+  if (!frame) {
+    frame = matchMethod(methodBegin);
+  }
+  if (!frame) {
+    frame = matchFile(methodBegin, methodBegin);
+  }
+  if (!frame) {
+    return std::nullopt;
+  }
+  return parseStackFrame(
+      frame->file, frame->methodName, frame->lineNumber, frame->column);
 }
 
 std::vector<JsErrorHandler::ParsedError::StackFrame> parseOthers(
-    const std::string& stackString) {
+    std::string_view stackString) {
   std::vector<JsErrorHandler::ParsedError::StackFrame> stack;
-  std::istringstream iss(stackString);
-  std::string line;
 
-  while (std::getline(iss, line)) {
+  for (size_t lineBegin = 0; lineBegin < stackString.size();) {
+    size_t lineEnd =
+        std::min(stackString.size(), stackString.find('\n', lineBegin));
+    auto line = trimTrailingSpaces(
+        stackString.substr(lineBegin, lineEnd - lineBegin));
+    lineBegin = lineEnd + 1;
+
     std::optional<JsErrorHandler::ParsedError::StackFrame> frame =
         parseChrome(line);
 
@@ -187,7 +621,7 @@ std::vector<JsErrorHandler::ParsedError::StackFrame> parseOthers(
     }
 
     if (frame) {
-      stack.push_back(*frame);
+      stack.push_back(std::move(*frame));
     }
   }
 
@@ -201,21 +635,21 @@ std::vector<JsErrorHandler::ParsedError::StackFrame> parseOthers(
  */
 namespace {
 struct HermesStackLocation {
-  std::string type;
-  std::string sourceUrl;
+  std::string_view type;
+  std::string_view sourceUrl;
   int line1Based{};
   int column1Based{};
   int virtualOffset0Based{};
 };
 
 struct HermesStackEntry {
-  std::string type;
-  std::string functionName;
+  std::string_view type;
+  std::string_view functionName;
   HermesStackLocation location;
   int count{};
 };
 
-bool isInternalBytecodeSourceUrl(const std::string& sourceUrl) {
+bool isInternalBytecodeSourceUrl(std::string_view sourceUrl) {
   return sourceUrl == "InternalBytecode.js";
 }
 
@@ -244,52 +678,94 @@ std::vector<JsErrorHandler::ParsedError::StackFrame> convertHermesStack(
   return frames;
 }
 
-HermesStackEntry parseLine(const std::string& line) {
-  static const std::regex RE_FRAME(
-      R"(^ {4}at (.+?)(?: \((native)\)?| \((address at )?(.*?):(\d+):(\d+)\))$)");
-  static const std::regex RE_SKIPPED(R"(^ {4}... skipping (\d+) frames$)");
+int toIntOrThrow(std::string_view number) {
+  return std::stoi(std::string(number));
+}
+
+// ^ {4}at .*?$
+bool isComponentFrameWithoutLocation(std::string_view line) {
+  return hasPrefixAt(line, 0, "    at ") && !hasLineTerminator(line);
+}
+
+HermesStackEntry parseLine(std::string_view line) {
   HermesStackEntry entry;
-  std::smatch match;
-  if (std::regex_match(line, match, RE_FRAME)) {
-    entry.type = "FRAME";
-    entry.functionName = match[1].str();
-    std::string type = match[2].str();
-    std::string addressAt = match[3].str();
-    std::string sourceUrl = match[4].str();
-    if (type == "native") {
-      entry.location.type = "NATIVE";
-    } else {
-      int line1Based = std::stoi(match[5].str());
-      int columnOrOffset = std::stoi(match[6].str());
-      if (addressAt == "address at ") {
-        if (isInternalBytecodeSourceUrl(sourceUrl)) {
-          entry.location = {
-              "INTERNAL_BYTECODE", sourceUrl, line1Based, 0, columnOrOffset};
+  if (hasLineTerminator(line)) {
+    return entry;
+  }
+
+  // ^ {4}at (.+?)(?: \((native)\)?| \((address at )?(.*?):(\d+):(\d+)\))$
+  if (hasPrefixAt(line, 0, "    at ")) {
+    // A source location, if any, must be the `:<line>:<column>)` ending
+    // the line.
+    std::optional<Location> location;
+    if (hasPrefixAt(line, line.size() - 1, ")")) {
+      location = findLocations(line, line.size() - 1, true).findFirst(0);
+      if (location && location->column.empty()) {
+        location.reset();
+      }
+    }
+    // The function name is the shortest one followed by a valid suffix.
+    for (size_t pos = line.find(" (", 8); pos != npos;
+         pos = line.find(" (", pos + 1)) {
+      auto suffix = line.substr(pos);
+      if (suffix == " (native" || suffix == " (native)") {
+        entry.type = "FRAME";
+        entry.functionName = line.substr(7, pos - 7);
+        entry.location.type = "NATIVE";
+        return entry;
+      }
+      if (location && location->fileEnd >= pos + 2) {
+        entry.type = "FRAME";
+        entry.functionName = line.substr(7, pos - 7);
+        size_t sourceUrlBegin = pos + 2;
+        bool isAddress = hasPrefixAt(line, sourceUrlBegin, "address at ");
+        if (isAddress) {
+          sourceUrlBegin += 11;
+        }
+        auto sourceUrl = line.substr(
+            sourceUrlBegin, location->fileEnd - sourceUrlBegin);
+        int line1Based = toIntOrThrow(location->lineNumber);
+        int columnOrOffset = toIntOrThrow(location->column);
+        if (isAddress) {
+          if (isInternalBytecodeSourceUrl(sourceUrl)) {
+            entry.location = {
+                "INTERNAL_BYTECODE", sourceUrl, line1Based, 0, columnOrOffset};
+          } else {
+            entry.location = {
+                "BYTECODE", sourceUrl, line1Based, 0, columnOrOffset};
+          }
         } else {
           entry.location = {
-              "BYTECODE", sourceUrl, line1Based, 0, columnOrOffset};
+              "SOURCE", sourceUrl, line1Based, columnOrOffset, 0};
         }
-      } else {
-        entry.location = {"SOURCE", sourceUrl, line1Based, columnOrOffset, 0};
+        return entry;
       }
     }
-    return entry;
   }
-  if (std::regex_match(line, match, RE_SKIPPED)) {
-    entry.type = "SKIPPED";
-    entry.count = std::stoi(match[1].str());
+
+  // ^ {4}... skipping (\d+) frames$
+  constexpr std::string_view skipping = " skipping ";
+  constexpr std::string_view frames = " frames";
+  if (hasPrefixAt(line, 0, "    ") && hasPrefixAt(line, 7, skipping) &&
+      line.size() > 17 + frames.size() &&
+      hasPrefixAt(line, line.size() - frames.size(), frames)) {
+    auto count = line.substr(17, line.size() - frames.size() - 17);
+    if (skipDigits(count, 0) == count.size()) {
+      entry.type = "SKIPPED";
+      entry.count = toIntOrThrow(count);
+    }
   }
   return entry;
 }
 
 std::vector<JsErrorHandler::ParsedError::StackFrame> parseHermes(
-    const std::string& stack) {
-  static const std::regex RE_COMPONENT_NO_STACK(R"(^ {4}at .*?$)");
-  std::istringstream stream(stack);
-  std::string line;
+    std::string_view stack) {
   std::vector<HermesStackEntry> entries;
-  std::smatch match;
-  while (std::getline(stream, line)) {
+  for (size_t lineBegin = 0; lineBegin < stack.size();) {
+    size_t lineEnd = std::min(stack.size(), stack.find('\n', lineBegin));
+    auto line = stack.substr(lineBegin, lineEnd - lineBegin);
+    lineBegin = lineEnd + 1;
+
     if (line.empty()) {
       continue;
     }
@@ -299,7 +775,7 @@ std::vector<JsErrorHandler::ParsedError::StackFrame> parseHermes(
       continue;
     }
 
-    if (std::regex_match(line, match, RE_COMPONENT_NO_STACK)) {
+    if (isComponentFrameWithoutLocation(line)) {
       continue;
     }
     entries.clear();
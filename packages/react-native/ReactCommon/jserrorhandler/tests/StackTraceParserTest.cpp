@@ -1194,3 +1194,28 @@ TEST(StackTraceParser, handleNonStandardLines) {
         actualStackFrames[i].methodName, expectedStackFrames[i].methodName);
   }
 }
+
+TEST(StackTraceParser, windowsLineEndings) {
+  auto actualStackFrames = StackTraceParser::parse(
+      false,
+      "Error: Default error\r\n"
+      "    at dumpExceptionError (http://localhost:8080/file.js:41:27)\r\n"
+      "    at HTMLButtonElement.onclick (http://localhost:8080/file.js:107:146)\r\n"
+      "    at I.e.fn.(anonymous function) [as index] (http://localhost:8080/file.js:10:3651)\r\n");
+  EXPECT_EQ(actualStackFrames.size(), 3);
+  std::vector<JsErrorHandler::ParsedError::StackFrame> expectedStackFrames = {
+      {"http://localhost:8080/file.js", "dumpExceptionError", 41, 26},
+      {"http://localhost:8080/file.js", "HTMLButtonElement.onclick", 107, 145},
+      {"http://localhost:8080/file.js",
+       "I.e.fn.(anonymous function) [as index]",
+       10,
+       3650}};
+  for (size_t i = 0; i < expectedStackFrames.size(); i++) {
+    EXPECT_EQ(actualStackFrames[i].column, expectedStackFrames[i].column);
+    EXPECT_EQ(actualStackFrames[i].file, expectedStackFrames[i].file);
+    EXPECT_EQ(
+        actualStackFrames[i].lineNumber, expectedStackFrames[i].lineNumber);
+    EXPECT_EQ(
+        actualStackFrames[i].methodName, expectedStackFrames[i].methodName);
+  }
+}
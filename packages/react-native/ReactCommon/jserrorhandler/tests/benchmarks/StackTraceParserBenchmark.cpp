@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <jserrorhandler/StackTraceParser.h>
+#include <string>
+
+namespace facebook::react {
+
+namespace {
+
+// A render error thrown from a list item, as reported once per item during
+// an error storm.
+std::string makeStack(
+    const std::string& framePrefix,
+    const std::string& frameSuffix,
+    size_t numberOfFrames) {
+  std::string stack = "TypeError: undefined is not an object\n";
+  for (size_t i = 0; i < numberOfFrames; i++) {
+    stack += framePrefix + "renderItem" + std::to_string(i) + frameSuffix +
+        std::to_string(1000 + i) + ":" + std::to_string(24 + i) + ")\n";
+  }
+  return stack;
+}
+
+auto hermesStack = makeStack("    at ", " (index.bundle:", 30);
+auto chromeStack =
+    makeStack("    at ", " (http://localhost:8081/index.bundle:", 30);
+auto nodeStack = makeStack("    at ", " (C:\\projects\\app\\index.js:", 30);
+
+std::string makeJavaScriptCoreStack(size_t numberOfFrames) {
+  std::string stack;
+  for (size_t i = 0; i < numberOfFrames; i++) {
+    stack += "renderItem" + std::to_string(i) +
+        "@http://localhost:8081/index.bundle:" + std::to_string(1000 + i) +
+        ":" + std::to_string(24 + i) + "\n";
+  }
+  return stack;
+}
+
+auto javaScriptCoreStack = makeJavaScriptCoreStack(30);
+
+} // namespace
+
+static void parseHermesStack(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(StackTraceParser::parse(true, hermesStack));
+  }
+}
+BENCHMARK(parseHermesStack);
+
+static void parseChromeStack(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(StackTraceParser::parse(false, chromeStack));
+  }
+}
+BENCHMARK(parseChromeStack);
+
+static void parseNodeStack(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(StackTraceParser::parse(false, nodeStack));
+  }
+}
+BENCHMARK(parseNodeStack);
+
+static void parseJavaScriptCoreStack(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        StackTraceParser::parse(false, javaScriptCoreStack));
+  }
+}
+BENCHMARK(parseJavaScriptCoreStack);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -11,6 +11,8 @@
 
 #include <folly/dynamic.h>
 #include <jsi/jsi.h>
+#include <string_view>
+#include <unordered_map>
 
 using namespace facebook::jsi;
 
@@ -19,6 +21,41 @@ namespace jsi {
 
 namespace {
 
+bool isAllAscii(const std::string& str) {
+  for (char c : str) {
+    if (static_cast<unsigned char>(c) >= 0x80) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// ASCII strings (the vast majority of keys and values in props payloads) can
+// skip UTF-8 decoding on the VM side.
+String stringFromUtf8(Runtime& runtime, const std::string& str) {
+  return isAllAscii(str) ? String::createFromAscii(runtime, str)
+                         : String::createFromUtf8(runtime, str);
+}
+
+// Arrays of objects usually repeat the same keys (e.g. list items), so the
+// PropNameIDs are created once per conversion and reused. Keys point into the
+// input dynamic, which outlives the conversion.
+class PropNameIDCache {
+ public:
+  const PropNameID& get(Runtime& runtime, const std::string& name) {
+    auto it = cache_.find(name);
+    if (it == cache_.end()) {
+      auto propName = isAllAscii(name) ? PropNameID::forAscii(runtime, name)
+                                       : PropNameID::forUtf8(runtime, name);
+      it = cache_.emplace(name, std::move(propName)).first;
+    }
+    return it->second;
+  }
+
+ private:
+  std::unordered_map<std::string_view, PropNameID> cache_;
+};
+
 struct FromDynamic {
   FromDynamic(const folly::dynamic* dynArg, Object objArg)
       : dyn(dynArg), obj(std::move(objArg)) {}
@@ -55,7 +92,7 @@ Value valueFromDynamicShallow(
       return ret;
     }
     case folly::dynamic::STRING:
-      return Value(String::createFromUtf8(runtime, dyn.getString()));
+      return Value(stringFromUtf8(runtime, dyn.getString()));
   }
   CHECK(false);
 }
@@ -64,6 +101,7 @@ Value valueFromDynamicShallow(
 
 Value valueFromDynamic(Runtime& runtime, const folly::dynamic& dynInput) {
   std::vector<FromDynamic> stack;
+  PropNameIDCache propNameIDCache;
 
   Value ret = valueFromDynamicShallow(runtime, stack, dynInput);
 
@@ -85,10 +123,15 @@ Value valueFromDynamic(Runtime& runtime, const folly::dynamic& dynInput) {
       case folly::dynamic::OBJECT: {
         Object obj = std::move(top.obj);
         for (const auto& element : top.dyn->items()) {
-          if (element.first.isNumber() || element.first.isString()) {
+          if (element.first.isString()) {
+            obj.setProperty(
+                runtime,
+                propNameIDCache.get(runtime, element.first.getString()),
+                valueFromDynamicShallow(runtime, stack, element.second));
+          } else if (element.first.isNumber()) {
             obj.setProperty(
                 runtime,
-                PropNameID::forUtf8(runtime, element.first.asString()),
+                PropNameID::forAscii(runtime, element.first.asString()),
                 valueFromDynamicShallow(runtime, stack, element.second));
           }
         }
@@ -105,11 +148,12 @@ Value valueFromDynamic(Runtime& runtime, const folly::dynamic& dynInput) {
 namespace {
 
 struct FromValue {
-  FromValue(folly::dynamic* dynArg, Object objArg)
-      : dyn(dynArg), obj(std::move(objArg)) {}
+  FromValue(folly::dynamic* dynArg, Object objArg, bool isArrayArg)
+      : dyn(dynArg), obj(std::move(objArg)), isArray(isArrayArg) {}
 
   folly::dynamic* dyn;
   Object obj;
+  bool isArray;
 };
 
 // This converts one element.  If it's a collection, it gets pushed
@@ -131,14 +175,15 @@ void dynamicFromValueShallow(
     output = value.getString(runtime).utf8(runtime);
   } else if (value.isObject()) {
     Object obj = value.getObject(runtime);
-    if (obj.isArray(runtime)) {
+    bool isArray = obj.isArray(runtime);
+    if (isArray) {
       output = folly::dynamic::array();
     } else if (obj.isFunction(runtime)) {
       throw JSError(runtime, "JS Functions are not convertible to dynamic");
     } else {
       output = folly::dynamic::object();
     }
-    stack.emplace_back(&output, std::move(obj));
+    stack.emplace_back(&output, std::move(obj), isArray);
   } else if (value.isBigInt()) {
     throw JSError(runtime, "JS BigInts are not convertible to dynamic");
   } else if (value.isSymbol()) {
@@ -163,23 +208,23 @@ folly::dynamic dynamicFromValue(
     auto top = std::move(stack.back());
     stack.pop_back();
 
-    if (top.obj.isArray(runtime)) {
+    if (top.isArray) {
       // Inserting into a dyn can invalidate references into it, so we
-      // need to insert new elements up front, then push stuff onto
-      // the stack.
-      Array array = top.obj.getArray(runtime);
+      // need to size the array up front, then push stuff onto the stack.
+      Array array = std::move(top.obj).getArray(runtime);
       size_t arraySize = array.size(runtime);
-      for (size_t i = 0; i < arraySize; ++i) {
-        top.dyn->push_back(nullptr);
-      }
+      top.dyn->resize(arraySize);
       for (size_t i = 0; i < arraySize; ++i) {
         dynamicFromValueShallow(
             runtime, stack, array.getValueAtIndex(runtime, i), top.dyn->at(i));
       }
     } else {
+      // Object values are stored in a node-based map, so references to them
+      // stay valid across insertions and we can fill them in a single pass.
       Array names = top.obj.getPropertyNames(runtime);
-      std::vector<std::pair<std::string, jsi::Value>> props;
-      for (size_t i = 0; i < names.size(runtime); ++i) {
+      size_t namesSize = names.size(runtime);
+      top.dyn->reserve(namesSize);
+      for (size_t i = 0; i < namesSize; ++i) {
         String name = names.getValueAtIndex(runtime, i).getString(runtime);
         Value prop = top.obj.getProperty(runtime, name);
         if (prop.isUndefined()) {
@@ -195,12 +240,8 @@ folly::dynamic dynamicFromValue(
         if (prop.isObject() && prop.getObject(runtime).isFunction(runtime)) {
           prop = Value::null();
         }
-        props.emplace_back(std::move(nameStr), std::move(prop));
-        top.dyn->insert(props.back().first, nullptr);
-      }
-      for (const auto& prop : props) {
         dynamicFromValueShallow(
-            runtime, stack, prop.second, (*top.dyn)[prop.first]);
+            runtime, stack, prop, (*top.dyn)[std::move(nameStr)]);
       }
     }
   }
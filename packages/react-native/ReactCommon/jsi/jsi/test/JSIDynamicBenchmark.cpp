@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <folly/dynamic.h>
+#include <folly/json.h>
+#include <hermes/hermes.h>
+#include <jsi/JSIDynamic.h>
+#include <memory>
+#include <string>
+
+namespace facebook::jsi {
+
+namespace {
+
+auto runtime = facebook::hermes::makeHermesRuntime();
+
+// Props as sent by `createNode` for a typical styled View.
+auto viewPropsDynamic = folly::parseJson(R"({
+  "style": {
+    "flex": 1,
+    "flexDirection": "row",
+    "alignItems": "center",
+    "paddingHorizontal": 16,
+    "paddingVertical": 8,
+    "backgroundColor": 4294967295,
+    "borderRadius": 12,
+    "opacity": 0.9,
+    "transform": [{"translateX": 10}, {"scale": 1.5}]
+  },
+  "accessible": true,
+  "accessibilityLabel": "Open conversation",
+  "nativeID": "conversation-row",
+  "testID": "ConversationRow",
+  "pointerEvents": "box-none",
+  "hitSlop": {"top": 8, "bottom": 8, "left": 8, "right": 8}
+})");
+
+// A list of items sharing the same shape, e.g. the `data` of a FlatList
+// passed to a TurboModule.
+folly::dynamic makeListPayload() {
+  auto items = folly::dynamic::array();
+  for (int i = 0; i < 100; i++) {
+    items.push_back(folly::dynamic::object("id", i)(
+        "title", "Item title " + std::to_string(i))("subtitle", "Ünïcödé")(
+        "unread", i % 2 == 0)("timestamp", 1700000000.0 + i));
+  }
+  return items;
+}
+
+auto listPayloadDynamic = makeListPayload();
+
+auto viewPropsValue = jsi::valueFromDynamic(*runtime, viewPropsDynamic);
+auto listPayloadValue = jsi::valueFromDynamic(*runtime, listPayloadDynamic);
+
+} // namespace
+
+static void valueFromDynamicViewProps(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        jsi::valueFromDynamic(*runtime, viewPropsDynamic));
+  }
+}
+BENCHMARK(valueFromDynamicViewProps);
+
+static void valueFromDynamicListPayload(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        jsi::valueFromDynamic(*runtime, listPayloadDynamic));
+  }
+}
+BENCHMARK(valueFromDynamicListPayload);
+
+static void dynamicFromValueViewProps(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(jsi::dynamicFromValue(*runtime, viewPropsValue));
+  }
+}
+BENCHMARK(dynamicFromValueViewProps);
+
+static void dynamicFromValueListPayload(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        jsi::dynamicFromValue(*runtime, listPayloadValue));
+  }
+}
+BENCHMARK(dynamicFromValueListPayload);
+
+} // namespace facebook::jsi
+
+BENCHMARK_MAIN();
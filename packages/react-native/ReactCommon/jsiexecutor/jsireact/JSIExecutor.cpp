@@ -9,6 +9,7 @@
 
 #include <cxxreact/ErrorUtils.h>
 #include <cxxreact/JSBigString.h>
+#include <cxxreact/MethodCall.h>
 #include <cxxreact/ModuleRegistry.h>
 #include <cxxreact/ReactMarker.h>
 #include <cxxreact/SystraceSection.h>
@@ -396,6 +397,20 @@ void JSIExecutor::callNativeModules(const Value& queue, bool isEndOfBatch) {
 #endif
   BridgeNativeModulePerfLogger::asyncMethodCallBatchPreprocessStart();
 
+  if (queue.isObject()) {
+    auto queueObject = queue.getObject(*runtime_);
+    if (queueObject.isArrayBuffer(*runtime_)) {
+      // Batches in the binary format are decoded straight from the buffer,
+      // skipping the property-by-property JSI -> folly::dynamic conversion.
+      auto buffer = queueObject.getArrayBuffer(*runtime_);
+      delegate_->callNativeModules(
+          *this,
+          parseMethodCalls(buffer.data(*runtime_), buffer.size(*runtime_)),
+          isEndOfBatch);
+      return;
+    }
+  }
+
   delegate_->callNativeModules(
       *this, dynamicFromValue(*runtime_, queue), isEndOfBatch);
 }
@@ -441,7 +456,7 @@ Value JSIExecutor::nativeRequire(const Value* args, size_t count) {
   auto module = bundleRegistry_->getModule(bundleId, moduleId);
 
   runtime_->evaluateJavaScript(
-      std::make_unique<StringBuffer>(module.code), module.name);
+      std::make_unique<StringBuffer>(std::move(module.code)), module.name);
   return facebook::jsi::Value();
 }
 
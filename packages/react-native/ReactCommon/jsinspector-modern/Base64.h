@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <string_view>
 
@@ -95,4 +96,55 @@ inline std::string base64Encode(const std::string_view s) {
   return res;
 }
 
+/**
+ * Base64-encodes data given in consecutive slices (e.g. the chunks of a
+ * buffer), appending the encoding to a string. Equivalent to appending
+ * base64Encode() of the concatenated slices, without concatenating them.
+ */
+class Base64Encoder {
+ public:
+  explicit Base64Encoder(std::string& out) : out_(out) {}
+
+  void write(std::string_view data) {
+    if (pendingSize_ > 0) {
+      while (pendingSize_ < 3 && !data.empty()) {
+        pending_[pendingSize_++] = data.front();
+        data.remove_prefix(1);
+      }
+      if (pendingSize_ < 3) {
+        return;
+      }
+      append(std::string_view(pending_, 3));
+      pendingSize_ = 0;
+    }
+
+    auto wholeGroupsSize = data.size() / 3 * 3;
+    append(data.substr(0, wholeGroupsSize));
+    for (auto c : data.substr(wholeGroupsSize)) {
+      pending_[pendingSize_++] = c;
+    }
+  }
+
+  /**
+   * Encodes (and pads) the remaining 0-2 bytes. Must be called once, after
+   * the last write().
+   */
+  void finish() {
+    append(std::string_view(pending_, pendingSize_));
+    pendingSize_ = 0;
+  }
+
+ private:
+  void append(std::string_view data) {
+    auto size = out_.size();
+    out_.resize(size + base64EncodedSize(data.size()));
+    Base64ScalarImpl<false>::encode(
+        data.data(), data.data() + data.size(), out_.data() + size);
+  }
+
+  std::string& out_;
+  char pending_[3]{};
+  std::size_t pendingSize_{0};
+};
+
 } // namespace facebook::react::jsinspector_modern
@@ -10,9 +10,320 @@
 #include <folly/dynamic.h>
 #include <folly/json.h>
 
+#include <charconv>
+
 namespace facebook::react::jsinspector_modern::cdp {
 
+namespace {
+
+/**
+ * Maximum nesting of the values skipped by Preparser, matching the default
+ * recursion limit of folly::parseJson.
+ */
+constexpr int kMaxDepth = 100;
+
+/**
+ * Scans a JSON-encoded request for `id`, `method` and (the JSON encoding of)
+ * `params`, validating the rest of the document without materializing it.
+ * Only handles requests in the usual shape: anything else (including invalid
+ * JSON) makes `preparse` fall back to parsing the whole document with folly,
+ * which also reports errors consistently.
+ */
+class Preparser {
+ public:
+  explicit Preparser(std::string_view json) : json_(json) {}
+
+  std::optional<PreparsedRequest> preparse() {
+    skipWhitespace();
+    if (!consume('{')) {
+      return std::nullopt;
+    }
+
+    std::optional<RequestId> id;
+    std::optional<std::string_view> method;
+    std::optional<std::string_view> params;
+
+    skipWhitespace();
+    if (!consume('}')) {
+      do {
+        skipWhitespace();
+        bool hasEscapes = false;
+        auto key = scanString(hasEscapes);
+        skipWhitespace();
+        if (!key || hasEscapes || !consume(':')) {
+          return std::nullopt;
+        }
+        skipWhitespace();
+
+        if (*key == "id") {
+          if (id) {
+            return std::nullopt;
+          }
+          id = scanInteger();
+          if (!id) {
+            return std::nullopt;
+          }
+        } else if (*key == "method") {
+          if (method) {
+            return std::nullopt;
+          }
+          method = scanString(hasEscapes);
+          if (!method || hasEscapes) {
+            return std::nullopt;
+          }
+        } else if (*key == "params") {
+          if (params) {
+            return std::nullopt;
+          }
+          auto start = position_;
+          if (!skipValue(0)) {
+            return std::nullopt;
+          }
+          params = json_.substr(start, position_ - start);
+        } else if (!skipValue(0)) {
+          return std::nullopt;
+        }
+
+        skipWhitespace();
+      } while (consume(','));
+
+      if (!consume('}')) {
+        return std::nullopt;
+      }
+    }
+
+    skipWhitespace();
+    if (position_ != json_.size() || !id || !method) {
+      return std::nullopt;
+    }
+
+    return PreparsedRequest{
+        .id = *id,
+        .method = std::string(*method),
+        .params = !params || *params == "null"
+            ? RequestParams()
+            : RequestParams::fromJson(std::string(*params))};
+  }
+
+ private:
+  char peek() const {
+    return position_ < json_.size() ? json_[position_] : '\0';
+  }
+
+  bool consume(char c) {
+    if (peek() != c) {
+      return false;
+    }
+    position_++;
+    return true;
+  }
+
+  bool consume(std::string_view literal) {
+    if (json_.substr(position_, literal.size()) != literal) {
+      return false;
+    }
+    position_ += literal.size();
+    return true;
+  }
+
+  void skipWhitespace() {
+    while (position_ < json_.size()) {
+      char c = json_[position_];
+      if (c != ' ' && c != '\t' && c != '\n' && c != '\r') {
+        return;
+      }
+      position_++;
+    }
+  }
+
+  static bool isDigit(char c) {
+    return c >= '0' && c <= '9';
+  }
+
+  static bool isHexDigit(char c) {
+    return isDigit(c) || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+  }
+
+  bool skipDigits() {
+    auto start = position_;
+    while (isDigit(peek())) {
+      position_++;
+    }
+    return position_ != start;
+  }
+
+  /**
+   * Returns the contents of a string (without the quotes and with escape
+   * sequences left as they are).
+   */
+  std::optional<std::string_view> scanString(bool& hasEscapes) {
+    hasEscapes = false;
+    if (!consume('"')) {
+      return std::nullopt;
+    }
+    auto start = position_;
+    while (position_ < json_.size()) {
+      char c = json_[position_++];
+      if (c == '"') {
+        return json_.substr(start, position_ - 1 - start);
+      }
+      if (static_cast<unsigned char>(c) < 0x20) {
+        return std::nullopt;
+      }
+      if (c == '\\') {
+        hasEscapes = true;
+        char escaped = peek();
+        position_++;
+        if (escaped == 'u') {
+          for (int i = 0; i < 4; i++) {
+            if (!isHexDigit(peek())) {
+              return std::nullopt;
+            }
+            position_++;
+          }
+        } else if (std::string_view("\"\\/bfnrt").find(escaped) ==
+                   std::string_view::npos) {
+          return std::nullopt;
+        }
+      }
+    }
+    return std::nullopt;
+  }
+
+  /**
+   * Scans a number. Sets `isInteger` if it has neither a fraction nor an
+   * exponent.
+   */
+  bool skipNumber(bool& isInteger) {
+    consume('-');
+    if (!consume('0') && !skipDigits()) {
+      return false;
+    }
+    isInteger = true;
+    if (consume('.')) {
+      isInteger = false;
+      if (!skipDigits()) {
+        return false;
+      }
+    }
+    if (consume('e') || consume('E')) {
+      isInteger = false;
+      if (!consume('+')) {
+        consume('-');
+      }
+      if (!skipDigits()) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  std::optional<RequestId> scanInteger() {
+    auto start = position_;
+    bool isInteger = false;
+    if (!skipNumber(isInteger) || !isInteger) {
+      return std::nullopt;
+    }
+    RequestId value{};
+    auto end = json_.data() + position_;
+    auto result = std::from_chars(json_.data() + start, end, value);
+    if (result.ec != std::errc() || result.ptr != end) {
+      return std::nullopt;
+    }
+    return value;
+  }
+
+  bool skipValue(int depth) {
+    if (depth > kMaxDepth) {
+      return false;
+    }
+    switch (peek()) {
+      case '{':
+        position_++;
+        skipWhitespace();
+        if (consume('}')) {
+          return true;
+        }
+        do {
+          skipWhitespace();
+          bool hasEscapes = false;
+          if (!scanString(hasEscapes)) {
+            return false;
+          }
+          skipWhitespace();
+          if (!consume(':')) {
+            return false;
+          }
+          skipWhitespace();
+          if (!skipValue(depth + 1)) {
+            return false;
+          }
+          skipWhitespace();
+        } while (consume(','));
+        return consume('}');
+      case '[':
+        position_++;
+        skipWhitespace();
+        if (consume(']')) {
+          return true;
+        }
+        do {
+          skipWhitespace();
+          if (!skipValue(depth + 1)) {
+            return false;
+          }
+          skipWhitespace();
+        } while (consume(','));
+        return consume(']');
+      case '"': {
+        bool hasEscapes = false;
+        return scanString(hasEscapes).has_value();
+      }
+      case 't':
+        return consume(std::string_view("true"));
+      case 'f':
+        return consume(std::string_view("false"));
+      case 'n':
+        return consume(std::string_view("null"));
+      default: {
+        bool isInteger = false;
+        return skipNumber(isInteger);
+      }
+    }
+  }
+
+  std::string_view json_;
+  size_t position_{0};
+};
+
+} // namespace
+
+RequestParams RequestParams::fromJson(std::string json) {
+  RequestParams params;
+  params.json_ = std::move(json);
+  return params;
+}
+
+const folly::dynamic& RequestParams::get() const {
+  if (json_) {
+    value_ = folly::parseJson(*json_);
+    json_.reset();
+  }
+  return value_;
+}
+
+std::string RequestParams::toJson() const {
+  if (json_) {
+    return *json_;
+  }
+  return folly::toJson(value_);
+}
+
 PreparsedRequest preparse(std::string_view message) {
+  if (auto request = Preparser(message).preparse()) {
+    return std::move(*request);
+  }
+
   folly::dynamic parsed = folly::parseJson(message);
   return PreparsedRequest{
       .id = parsed["id"].getInt(),
@@ -21,13 +332,16 @@ PreparsedRequest preparse(std::string_view message) {
 }
 
 std::string PreparsedRequest::toJson() const {
-  folly::dynamic obj = folly::dynamic::object;
-  obj["id"] = id;
-  obj["method"] = method;
-  if (params != nullptr) {
-    obj["params"] = params;
+  std::string json = "{\"id\":";
+  json += std::to_string(id);
+  json += ",\"method\":";
+  folly::json::escapeString(method, json, folly::json::serialization_opts());
+  if (!params.isNull()) {
+    json += ",\"params\":";
+    json += params.toJson();
   }
-  return folly::toJson(obj);
+  json += '}';
+  return json;
 }
 
 std::string jsonError(
@@ -58,6 +372,17 @@ std::string jsonNotification(
   return folly::toJson(std::move(dynamicNotification));
 }
 
+std::string jsonNotificationWithParamsJson(
+    std::string_view method,
+    std::string_view paramsJson) {
+  std::string json = "{\"method\":";
+  folly::json::escapeString(method, json, folly::json::serialization_opts());
+  json += ",\"params\":";
+  json += paramsJson;
+  json += '}';
+  return json;
+}
+
 std::string jsonRequest(
     RequestId id,
     std::string_view method,
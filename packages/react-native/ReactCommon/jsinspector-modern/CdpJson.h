@@ -9,8 +9,10 @@
 
 #include <folly/dynamic.h>
 #include <folly/json.h>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <utility>
 
 namespace facebook::react::jsinspector_modern::cdp {
 
@@ -29,6 +31,80 @@ enum class ErrorCode {
   /* -32000 to -32099: Implementation-defined server errors. */
 };
 
+/**
+ * The parameters of an incoming CDP request. When preparsed from JSON, they
+ * are only parsed into a folly::dynamic when accessed, which many requests
+ * (e.g. the ones forwarded to the JS engine as JSON) never do.
+ */
+class RequestParams {
+ public:
+  /**
+   * Constructs null params.
+   */
+  RequestParams() = default;
+
+  /* implicit */ RequestParams(folly::dynamic value)
+      : value_(std::move(value)) {}
+
+  /**
+   * Constructs params from their JSON encoding, which must be valid JSON.
+   */
+  static RequestParams fromJson(std::string json);
+
+  /**
+   * Returns the parsed params.
+   * \throws ParseError If the JSON encoding cannot be parsed.
+   */
+  const folly::dynamic& get() const;
+
+  /* implicit */ operator const folly::dynamic&() const {
+    return get();
+  }
+
+  /**
+   * Shorthands for the folly::dynamic methods commonly used on params.
+   */
+  bool isObject() const {
+    return get().isObject();
+  }
+
+  template <typename K>
+  auto count(K&& key) const {
+    return get().count(std::forward<K>(key));
+  }
+
+  template <typename K>
+  decltype(auto) at(K&& key) const {
+    return get().at(std::forward<K>(key));
+  }
+
+  template <typename K>
+  decltype(auto) operator[](K&& key) const {
+    return get()[std::forward<K>(key)];
+  }
+
+  bool isNull() const {
+    return !json_ && value_.isNull();
+  }
+
+  /**
+   * Returns the JSON encoding of the params, without parsing them if they
+   * were constructed from JSON.
+   */
+  std::string toJson() const;
+
+  inline bool operator==(const RequestParams& rhs) const {
+    return get() == rhs.get();
+  }
+
+ private:
+  /**
+   * The JSON encoding, until it is parsed into value_.
+   */
+  mutable std::optional<std::string> json_;
+  mutable folly::dynamic value_;
+};
+
 /**
  * An incoming CDP request that has been parsed into a more usable form.
  */
@@ -47,7 +123,7 @@ struct PreparsedRequest {
   /**
    * The parameters passed to the method, if any.
    */
-  folly::dynamic params;
+  RequestParams params;
 
   /**
    * Equality operator, useful for unit tests
@@ -60,7 +136,8 @@ struct PreparsedRequest {
 };
 
 /**
- * Parse a JSON-encoded CDP request into its constituent parts.
+ * Parse a JSON-encoded CDP request into its constituent parts. Only `id` and
+ * `method` are extracted eagerly, without materializing the whole document.
  * \throws ParseError If the input cannot be parsed.
  * \throws TypeError If the input does not conform to the expected format.
  */
@@ -121,6 +198,21 @@ std::string jsonNotification(
     std::string_view method,
     std::optional<folly::dynamic> params = std::nullopt);
 
+/**
+ * Returns a JSON-formatted string representing a unilateral notification,
+ * with params which are already JSON-encoded. Meant for frequent
+ * notifications, to avoid building (and copying payloads into) a
+ * folly::dynamic only to serialize it.
+ *
+ * {"method": <method>, "params": <paramsJson>}
+ *
+ * \param method Notification (aka "event") method.
+ * \param paramsJson JSON-encoded payload object, written as is.
+ */
+std::string jsonNotificationWithParamsJson(
+    std::string_view method,
+    std::string_view paramsJson);
+
 /**
  * Returns a JSON-formatted string representing a request.
  *
@@ -74,6 +74,12 @@ class HostTargetSession {
           cdp::jsonError(request.id, cdp::ErrorCode::InvalidRequest, e.what()));
       return;
     }
+    // Params are only parsed when accessed during request handling.
+    catch (const cdp::ParseError& e) {
+      frontendChannel_(
+          cdp::jsonError(request.id, cdp::ErrorCode::ParseError, e.what()));
+      return;
+    }
     // Catch exceptions for unrecognised or partially implemented CDP methods.
     catch (const NotImplementedException& e) {
       frontendChannel_(
@@ -9,6 +9,9 @@
 #include "CdpJson.h"
 #include "RuntimeTarget.h"
 
+#include <folly/Conv.h>
+#include <folly/json.h>
+
 namespace facebook::react::jsinspector_modern {
 
 InstanceAgent::InstanceAgent(
@@ -124,22 +127,35 @@ static std::string consoleMessageTypeName(ConsoleAPIType type) {
 void InstanceAgent::sendConsoleMessageImmediately(
     SimpleConsoleMessage message) {
   assert(runtimeAgent_ != nullptr);
-  folly::dynamic argsParam = folly::dynamic::array();
-  for (auto& arg : message.args) {
-    argsParam.push_back(folly::dynamic::object("type", "string")("value", arg));
+  const auto& executionContext =
+      runtimeAgent_->getExecutionContextDescription();
+  const folly::json::serialization_opts opts;
+
+  // Written directly rather than built as a folly::dynamic, as these messages
+  // can be frequent.
+  std::string params = R"({"type":)";
+  folly::json::escapeString(consoleMessageTypeName(message.type), params, opts);
+  params += R"(,"timestamp":)";
+  folly::toAppend(message.timestamp, &params);
+  params += R"(,"args":[)";
+  for (size_t i = 0; i < message.args.size(); i++) {
+    params += i == 0 ? R"({"type":"string","value":)"
+                     : R"(,{"type":"string","value":)";
+    folly::json::escapeString(message.args[i], params, opts);
+    params += '}';
   }
-  frontendChannel_(cdp::jsonNotification(
-      "Runtime.consoleAPICalled",
-      folly::dynamic::object("type", consoleMessageTypeName(message.type))(
-          "timestamp", message.timestamp)("args", std::move(argsParam))(
-          "executionContextId",
-          runtimeAgent_->getExecutionContextDescription().id)(
-          // We use the @cdp Runtime.consoleAPICalled `context` parameter to
-          // mark synthetic messages generated by the backend, i.e. not
-          // originating in a real `console.*` API call.
-          "context",
-          runtimeAgent_->getExecutionContextDescription().name +
-              "#InstanceAgent")));
+  params += R"(],"executionContextId":)";
+  folly::toAppend(executionContext.id, &params);
+  // We use the @cdp Runtime.consoleAPICalled `context` parameter to
+  // mark synthetic messages generated by the backend, i.e. not
+  // originating in a real `console.*` API call.
+  params += R"(,"context":)";
+  folly::json::escapeString(
+      executionContext.name + "#InstanceAgent", params, opts);
+  params += '}';
+
+  frontendChannel_(
+      cdp::jsonNotificationWithParamsJson("Runtime.consoleAPICalled", params));
 }
 
 void InstanceAgent::maybeSendPendingConsoleMessages() {
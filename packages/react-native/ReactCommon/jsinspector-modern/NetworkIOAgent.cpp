@@ -6,6 +6,8 @@
  */
 
 #include "NetworkIOAgent.h"
+#include <algorithm>
+#include <deque>
 #include <utility>
 #include "Base64.h"
 #include "Utf8.h"
@@ -38,6 +40,45 @@ using StreamInitCallback =
 using IOReadCallback =
     std::function<void(std::variant<IOReadError, IOReadResult>)>;
 
+/**
+ * Appends `text` to `out`, escaped for use within a JSON string.
+ */
+void appendJsonEscaped(std::string& out, std::string_view text) {
+  static constexpr char kHexDigits[] = "0123456789abcdef";
+  size_t unescapedStart = 0;
+  for (size_t i = 0; i < text.size(); i++) {
+    auto c = static_cast<unsigned char>(text[i]);
+    if (c >= 0x20 && c != '"' && c != '\\') {
+      continue;
+    }
+    out.append(text, unescapedStart, i - unescapedStart);
+    unescapedStart = i + 1;
+    switch (c) {
+      case '"':
+        out += "\\\"";
+        break;
+      case '\\':
+        out += "\\\\";
+        break;
+      case '\n':
+        out += "\\n";
+        break;
+      case '\r':
+        out += "\\r";
+        break;
+      case '\t':
+        out += "\\t";
+        break;
+      default:
+        out += "\\u00";
+        out += kHexDigits[c >> 4];
+        out += kHexDigits[c & 0xf];
+        break;
+    }
+  }
+  out.append(text, unescapedStart);
+}
+
 /**
  * Private class owning state and implementing the listener for a particular
  * request
@@ -75,12 +116,16 @@ class Stream : public NetworkRequestListener,
    * bytes, starting from the end of the previous read.
    * \param maxBytesToRead The maximum number of bytes to read from the
    * source stream.
+   * \param requestId The ID of the IO.read request, for the response.
    * \param callback Will be called using the executor passed to create()
    * with the result of the read, or an error string.
    */
-  void read(long maxBytesToRead, const IOReadCallback& callback) {
+  void read(
+      long maxBytesToRead,
+      cdp::RequestId requestId,
+      const IOReadCallback& callback) {
     pendingReadRequests_.emplace_back(
-        std::make_tuple(maxBytesToRead, callback));
+        std::make_tuple(maxBytesToRead, requestId, callback));
     processPending();
   }
 
@@ -108,8 +153,10 @@ class Stream : public NetworkRequestListener,
    */
 
   void onData(std::string_view data) override {
-    data_ << data;
-    bytesReceived_ += data.length();
+    if (!data.empty()) {
+      chunks_.emplace_back(data);
+      bytesBuffered_ += data.length();
+    }
     processPending();
   }
 
@@ -179,14 +226,15 @@ class Stream : public NetworkRequestListener,
     for (auto it = pendingReadRequests_.begin();
          it != pendingReadRequests_.end();) {
       auto maxBytesToRead = std::get<0>(*it);
-      auto callback = std::get<1>(*it);
+      auto requestId = std::get<1>(*it);
+      auto callback = std::get<2>(*it);
 
       if (error_) {
         callback(IOReadError{*error_});
       } else if (
-          completed_ || (bytesReceived_ - data_.tellg() >= maxBytesToRead)) {
+          completed_ || static_cast<long>(bytesBuffered_) >= maxBytesToRead) {
         try {
-          callback(respond(maxBytesToRead));
+          callback(respond(maxBytesToRead, requestId));
         } catch (const std::runtime_error& error) {
           callback(IOReadError{error.what()});
         }
@@ -199,32 +247,88 @@ class Stream : public NetworkRequestListener,
     }
   }
 
-  IOReadResult respond(long maxBytesToRead) {
-    std::vector<char> buffer(maxBytesToRead);
-    data_.read(buffer.data(), maxBytesToRead);
-    auto bytesRead = data_.gcount();
-    std::string output;
-
-    buffer.resize(bytesRead);
-    if (isText_) {
-      auto originalSize = buffer.size();
-      // Maybe resize to drop the last 1-3 bytes so that buffer is valid.
-      truncateToValidUTF8(buffer);
-      if (buffer.size() < originalSize) {
-        // Rewind the stream so that the next read starts from the start of
-        // the code point we're removing from this chunk.
-        data_.seekg(buffer.size() - originalSize, std::ios_base::cur);
+  /**
+   * Copies `size` bytes, starting `offset` bytes after the start of the
+   * unread data, to `out`.
+   */
+  void copyBuffered(size_t offset, size_t size, char* out) const {
+    offset += frontChunkOffset_;
+    for (const auto& chunk : chunks_) {
+      if (size == 0) {
+        break;
+      }
+      if (offset >= chunk.size()) {
+        offset -= chunk.size();
+        continue;
+      }
+      auto bytesToCopy = std::min(size, chunk.size() - offset);
+      std::copy_n(chunk.data() + offset, bytesToCopy, out);
+      out += bytesToCopy;
+      size -= bytesToCopy;
+      offset = 0;
+    }
+  }
+
+  /**
+   * Consumes up to maxBytesToRead bytes of the unread data, encoding them
+   * straight into the IO.read response and releasing the chunks which have
+   * been read entirely.
+   */
+  IOReadResult respond(long maxBytesToRead, cdp::RequestId requestId) {
+    auto bytesToRead = std::min(
+        static_cast<size_t>(std::max(maxBytesToRead, 0L)), bytesBuffered_);
+
+    if (isText_ && bytesToRead > 0) {
+      // Drop the last 1-3 bytes if needed so that the slice is valid UTF-8;
+      // the next read will start from the start of the code point we're
+      // removing from this one. Examining the last 5 bytes is equivalent to
+      // examining the whole slice.
+      std::vector<char> tail(std::min(bytesToRead, size_t{5}));
+      copyBuffered(bytesToRead - tail.size(), tail.size(), tail.data());
+      auto originalSize = tail.size();
+      truncateToValidUTF8(tail);
+      bytesToRead -= originalSize - tail.size();
+    }
+
+    std::string json = R"({"id":)";
+    json += std::to_string(requestId);
+    json += R"(,"result":{"data":")";
+    // Text may grow when escaped; it rarely contains characters which need
+    // escaping.
+    json.reserve(
+        json.size() +
+        (isText_ ? bytesToRead : base64EncodedSize(bytesToRead)) + 64);
+
+    Base64Encoder base64Encoder(json);
+    auto remaining = bytesToRead;
+    while (remaining > 0) {
+      const auto& chunk = chunks_.front();
+      auto slice =
+          std::string_view(chunk).substr(frontChunkOffset_, remaining);
+      if (isText_) {
+        appendJsonEscaped(json, slice);
+      } else {
+        base64Encoder.write(slice);
       }
-      output = std::string(buffer.begin(), buffer.begin() + buffer.size());
-    } else {
-      // Encode the slice as a base64 string.
-      output = base64Encode(std::string_view(buffer.data(), buffer.size()));
+      remaining -= slice.size();
+      bytesBuffered_ -= slice.size();
+      frontChunkOffset_ += slice.size();
+      if (frontChunkOffset_ == chunk.size()) {
+        chunks_.pop_front();
+        frontChunkOffset_ = 0;
+      }
+    }
+    if (!isText_) {
+      base64Encoder.finish();
     }
 
-    return IOReadResult{
-        .data = output,
-        .eof = output.length() == 0 && completed_,
-        .base64Encoded = !isText_};
+    json += R"(","eof":)";
+    json += bytesToRead == 0 && completed_ ? "true" : "false";
+    json += R"(,"base64Encoded":)";
+    json += isText_ ? "false" : "true";
+    json += "}}";
+
+    return IOReadResult{.json = std::move(json)};
   }
 
   // https://github.com/chromium/chromium/blob/128.0.6593.1/content/browser/devtools/devtools_io_context.cc#L70-L80
@@ -240,11 +344,19 @@ class Stream : public NetworkRequestListener,
   bool completed_{false};
   bool isText_{false};
   std::optional<std::string> error_;
-  std::stringstream data_;
-  long bytesReceived_{0};
+  /**
+   * Data received and not read yet. Chunks are released once read entirely;
+   * the first frontChunkOffset_ bytes of the first chunk have been read.
+   */
+  std::deque<std::string> chunks_;
+  size_t frontChunkOffset_{0};
+  size_t bytesBuffered_{0};
   std::optional<std::function<void()>> cancelFunction_{std::nullopt};
   std::unique_ptr<StreamInitCallback> initCb_;
-  std::vector<std::tuple<long /* bytesToRead */, IOReadCallback>>
+  std::vector<std::tuple<
+      long /* bytesToRead */,
+      cdp::RequestId,
+      IOReadCallback>>
       pendingReadRequests_;
 };
 } // namespace
@@ -386,6 +498,7 @@ void NetworkIOAgent::handleIoRead(const cdp::PreparsedRequest& req) {
   } else {
     it->second->read(
         size ? *size : DEFAULT_BYTES_PER_READ,
+        requestId,
         [requestId,
          frontendChannel = frontendChannel_,
          streamId,
@@ -396,7 +509,7 @@ void NetworkIOAgent::handleIoRead(const cdp::PreparsedRequest& req) {
             frontendChannel(cdp::jsonError(
                 requestId, cdp::ErrorCode::InternalError, *error));
           } else if (auto* result = std::get_if<IOReadResult>(&resultOrError)) {
-            frontendChannel(cdp::jsonResult(requestId, result->toDynamic()));
+            frontendChannel(result->json);
           } else {
             assert(false && "Unhandled IO read result type");
           }
@@ -78,16 +78,14 @@ struct NetworkResource {
   }
 };
 
+/**
+ * A successful IO.read, as the JSON-encoded CDP response
+ * ({"id": <id>, "result": {"data": <data>, "eof": <eof>,
+ * "base64Encoded": <base64Encoded>}}). The data is encoded straight from the
+ * stream's buffer into the response, without intermediate copies.
+ */
 struct IOReadResult {
-  std::string data;
-  bool eof;
-  bool base64Encoded;
-  folly::dynamic toDynamic() const {
-    auto obj = folly::dynamic::object("data", data);
-    obj("eof", eof);
-    obj("base64Encoded", base64Encoded);
-    return obj;
-  }
+  std::string json;
 };
 
 /**
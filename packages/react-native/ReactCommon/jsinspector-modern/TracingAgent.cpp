@@ -7,6 +7,7 @@
 
 #include "TracingAgent.h"
 
+#include <folly/json.h>
 #include <reactperflogger/fusebox/FuseboxTracer.h>
 
 namespace facebook::react::jsinspector_modern {
@@ -33,9 +34,13 @@ bool TracingAgent::handleRequest(const cdp::PreparsedRequest& req) {
           if (firstChunk) {
             frontendChannel_(cdp::jsonResult(id));
           }
-          frontendChannel_(cdp::jsonNotification(
-              "Tracing.dataCollected",
-              folly::dynamic::object("value", eventsChunk)));
+          // Serialized directly, to avoid copying the chunk into a params
+          // object.
+          std::string params = R"({"value":)";
+          params += folly::toJson(eventsChunk);
+          params += '}';
+          frontendChannel_(cdp::jsonNotificationWithParamsJson(
+              "Tracing.dataCollected", params));
         });
 
     if (!wasStopped) {
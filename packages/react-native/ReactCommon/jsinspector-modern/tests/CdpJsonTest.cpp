@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <jsinspector-modern/CdpJson.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "FollyDynamicMatchers.h"
+
+using namespace ::testing;
+
+namespace facebook::react::jsinspector_modern {
+
+TEST(CdpJsonTest, PreparseRequest) {
+  auto request = cdp::preparse(R"({
+    "method": "Runtime.addBinding",
+    "sessionId": "ignored",
+    "id": 42,
+    "params": {"name": "binding", "nested": [1, 2.5, "\"", null, true]}
+  })");
+
+  EXPECT_EQ(request.id, 42);
+  EXPECT_EQ(request.method, "Runtime.addBinding");
+  EXPECT_EQ(
+      request.params.get(),
+      folly::parseJson(
+          R"({"name": "binding", "nested": [1, 2.5, "\"", null, true]})"));
+  EXPECT_EQ(request.params["name"].getString(), "binding");
+}
+
+TEST(CdpJsonTest, PreparseRequestWithoutParams) {
+  auto request = cdp::preparse(R"({"id": -1, "method": "Runtime.enable"})");
+
+  EXPECT_EQ(
+      request,
+      (cdp::PreparsedRequest{.id = -1, .method = "Runtime.enable"}));
+  EXPECT_TRUE(request.params.isNull());
+  EXPECT_EQ(
+      cdp::preparse(R"({
+        "id": -1,
+        "method": "Runtime.enable",
+        "params": null
+      })"),
+      request);
+}
+
+TEST(CdpJsonTest, PreparseRequestInUnusualShape) {
+  // Parsed through folly::dynamic, the same as requests in the usual shape.
+  auto request =
+      cdp::preparse(R"({"id": 1, "method": "Runtime.\u0065nable"})");
+
+  EXPECT_EQ(request.id, 1);
+  EXPECT_EQ(request.method, "Runtime.enable");
+}
+
+TEST(CdpJsonTest, PreparseInvalidRequests) {
+  EXPECT_THROW(cdp::preparse(""), cdp::ParseError);
+  EXPECT_THROW(cdp::preparse(R"({"id": 1, "method": "A")"), cdp::ParseError);
+  EXPECT_THROW(
+      cdp::preparse(R"({"id": 1, "method": "A", "params": {"a": 01}})"),
+      cdp::ParseError);
+  EXPECT_THROW(
+      cdp::preparse(R"({"id": 1, "method": "A"} trailing)"), cdp::ParseError);
+
+  EXPECT_THROW(cdp::preparse(R"({"method": "A"})"), cdp::TypeError);
+  EXPECT_THROW(cdp::preparse(R"({"id": 1.5, "method": "A"})"), cdp::TypeError);
+  EXPECT_THROW(cdp::preparse(R"({"id": 1, "method": 1})"), cdp::TypeError);
+  EXPECT_THROW(cdp::preparse(R"([{"id": 1, "method": "A"}])"), cdp::TypeError);
+}
+
+TEST(CdpJsonTest, RequestToJson) {
+  auto request = cdp::preparse(
+      R"({"id": 1, "method": "Debugger.enable", "params": {"a": [1]}})");
+  EXPECT_THAT(request.toJson(), JsonEq(R"({
+        "id": 1,
+        "method": "Debugger.enable",
+        "params": {"a": [1]}
+      })"));
+
+  EXPECT_THAT(
+      (cdp::PreparsedRequest{
+           .id = 2,
+           .method = "Debugger.disable",
+           .params = folly::dynamic(folly::dynamic::object("b", "c"))})
+          .toJson(),
+      JsonEq(R"({
+        "id": 2,
+        "method": "Debugger.disable",
+        "params": {"b": "c"}
+      })"));
+}
+
+TEST(CdpJsonTest, NotificationWithParamsJson) {
+  EXPECT_THAT(
+      cdp::jsonNotificationWithParamsJson(
+          "Tracing.dataCollected", R"({"value": [{"name": "\"event\""}]})"),
+      JsonEq(R"({
+        "method": "Tracing.dataCollected",
+        "params": {"value": [{"name": "\"event\""}]}
+      })"));
+}
+
+} // namespace facebook::react::jsinspector_modern
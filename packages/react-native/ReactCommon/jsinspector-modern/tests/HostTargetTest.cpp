@@ -954,6 +954,90 @@ TEST_F(HostTargetTest, NetworkLoadNetworkResourceBinaryData) {
                         })");
 }
 
+TEST_F(HostTargetTest, NetworkLoadNetworkResourceReadsAcrossChunks) {
+  connect();
+
+  InSequence s;
+
+  ScopedExecutor<NetworkRequestListener> executor;
+  EXPECT_CALL(
+      hostTargetDelegate_,
+      loadNetworkResource(
+          Field(&LoadNetworkResourceRequest::url, "http://example.com"), _))
+      .Times(1)
+      .WillOnce([&executor](
+                    const LoadNetworkResourceRequest& /*params*/,
+                    ScopedExecutor<NetworkRequestListener> executorArg) {
+        // Capture the ScopedExecutor<NetworkRequestListener> to use later.
+        executor = std::move(executorArg);
+      })
+      .RetiresOnSaturation();
+
+  toPage_->sendMessage(R"({
+                           "id": 1,
+                           "method": "Network.loadNetworkResource",
+                           "params": {
+                             "url": "http://example.com"
+                            }
+                         })");
+
+  EXPECT_CALL(fromPage(), onMessage(JsonParsed(AtJsonPtr("/id", Eq(1)))));
+  executor([](NetworkRequestListener& listener) {
+    listener.onHeaders(200, Headers{{"Content-Type", "text/plain"}});
+    // "Grüße" followed by a quote, with code points split across chunks.
+    listener.onData("Gr\xC3");
+    listener.onData("\xBC\xC3");
+    listener.onData("\x9F\x65\"");
+  });
+
+  // The read ends in the middle of "ß", which is left for the next read.
+  EXPECT_CALL(fromPage(), onMessage(JsonEq(R"({
+                                            "id": 2,
+                                            "result": {
+                                              "data": "Grü",
+                                              "eof": false,
+                                              "base64Encoded": false
+                                            }
+                                          })")));
+  toPage_->sendMessage(R"({
+                          "id": 2,
+                          "method": "IO.read",
+                          "params": {
+                            "handle": "0",
+                            "size": 5
+                          }
+                        })");
+
+  EXPECT_CALL(fromPage(), onMessage(JsonEq(R"({
+                                            "id": 3,
+                                            "result": {
+                                              "data": "ße\"",
+                                              "eof": false,
+                                              "base64Encoded": false
+                                            }
+                                          })")));
+  toPage_->sendMessage(R"({
+                          "id": 3,
+                          "method": "IO.read",
+                          "params": {
+                            "handle": "0",
+                            "size": 4
+                          }
+                        })");
+
+  EXPECT_CALL(fromPage(), onMessage(JsonEq(R"({
+                                            "id": 4,
+                                            "result": {}
+                                          })")));
+  toPage_->sendMessage(R"({
+                          "id": 4,
+                          "method": "IO.close",
+                          "params": {
+                            "handle": "0"
+                          }
+                        })");
+}
+
 TEST_F(HostTargetTest, NetworkLoadNetworkResourceMimeIsTextContentIsNot) {
   connect();
 
@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<cfa6f544c0bcb190836329d8f597efc6>>
+ * @generated SignedSource<<d4d5c2e769a006d5b4517ee6023d43e7>>
  */
 
 /**
@@ -18,14 +18,96 @@
  */
 
 #include "ReactNativeFeatureFlags.h"
+#include <atomic>
+#include <cassert>
+#include <mutex>
+#include <vector>
 
 namespace facebook::react {
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wglobal-constructors"
 std::unique_ptr<ReactNativeFeatureFlagsAccessor> accessor_;
+
+namespace {
+
+std::mutex snapshotMutex_;
+
+#ifdef RN_CONSTEXPR_FEATURE_FLAGS
+// The flags never change in this mode, so they have a single snapshot.
+const ReactNativeFeatureFlagsSnapshot constexprSnapshot_{
+    .commonTestFlag = ReactNativeFeatureFlagsConstexprValues::commonTestFlag,
+    .completeReactInstanceCreationOnBgThreadOnAndroid = ReactNativeFeatureFlagsConstexprValues::completeReactInstanceCreationOnBgThreadOnAndroid,
+    .disableEventLoopOnBridgeless = ReactNativeFeatureFlagsConstexprValues::disableEventLoopOnBridgeless,
+    .disableMountItemReorderingAndroid = ReactNativeFeatureFlagsConstexprValues::disableMountItemReorderingAndroid,
+    .enableAlignItemsBaselineOnFabricIOS = ReactNativeFeatureFlagsConstexprValues::enableAlignItemsBaselineOnFabricIOS,
+    .enableAndroidLineHeightCentering = ReactNativeFeatureFlagsConstexprValues::enableAndroidLineHeightCentering,
+    .enableBridgelessArchitecture = ReactNativeFeatureFlagsConstexprValues::enableBridgelessArchitecture,
+    .enableCppPropsIteratorSetter = ReactNativeFeatureFlagsConstexprValues::enableCppPropsIteratorSetter,
+    .enableDeletionOfUnmountedViews = ReactNativeFeatureFlagsConstexprValues::enableDeletionOfUnmountedViews,
+    .enableEagerRootViewAttachment = ReactNativeFeatureFlagsConstexprValues::enableEagerRootViewAttachment,
+    .enableEventEmitterRetentionDuringGesturesOnAndroid = ReactNativeFeatureFlagsConstexprValues::enableEventEmitterRetentionDuringGesturesOnAndroid,
+    .enableFabricLogs = ReactNativeFeatureFlagsConstexprValues::enableFabricLogs,
+    .enableFabricRenderer = ReactNativeFeatureFlagsConstexprValues::enableFabricRenderer,
+    .enableFabricRendererExclusively = ReactNativeFeatureFlagsConstexprValues::enableFabricRendererExclusively,
+    .enableFixForViewCommandRace = ReactNativeFeatureFlagsConstexprValues::enableFixForViewCommandRace,
+    .enableGranularShadowTreeStateReconciliation = ReactNativeFeatureFlagsConstexprValues::enableGranularShadowTreeStateReconciliation,
+    .enableIOSViewClipToPaddingBox = ReactNativeFeatureFlagsConstexprValues::enableIOSViewClipToPaddingBox,
+    .enableLayoutAnimationsOnAndroid = ReactNativeFeatureFlagsConstexprValues::enableLayoutAnimationsOnAndroid,
+    .enableLayoutAnimationsOnIOS = ReactNativeFeatureFlagsConstexprValues::enableLayoutAnimationsOnIOS,
+    .enableLongTaskAPI = ReactNativeFeatureFlagsConstexprValues::enableLongTaskAPI,
+    .enableNewBackgroundAndBorderDrawables = ReactNativeFeatureFlagsConstexprValues::enableNewBackgroundAndBorderDrawables,
+    .enablePreciseSchedulingForPremountItemsOnAndroid = ReactNativeFeatureFlagsConstexprValues::enablePreciseSchedulingForPremountItemsOnAndroid,
+    .enablePropsUpdateReconciliationAndroid = ReactNativeFeatureFlagsConstexprValues::enablePropsUpdateReconciliationAndroid,
+    .enableReportEventPaintTime = ReactNativeFeatureFlagsConstexprValues::enableReportEventPaintTime,
+    .enableSynchronousStateUpdates = ReactNativeFeatureFlagsConstexprValues::enableSynchronousStateUpdates,
+    .enableUIConsistency = ReactNativeFeatureFlagsConstexprValues::enableUIConsistency,
+    .enableViewRecycling = ReactNativeFeatureFlagsConstexprValues::enableViewRecycling,
+    .excludeYogaFromRawProps = ReactNativeFeatureFlagsConstexprValues::excludeYogaFromRawProps,
+    .fixMappingOfEventPrioritiesBetweenFabricAndReact = ReactNativeFeatureFlagsConstexprValues::fixMappingOfEventPrioritiesBetweenFabricAndReact,
+    .fixMountingCoordinatorReportedPendingTransactionsOnAndroid = ReactNativeFeatureFlagsConstexprValues::fixMountingCoordinatorReportedPendingTransactionsOnAndroid,
+    .fuseboxEnabledDebug = ReactNativeFeatureFlagsConstexprValues::fuseboxEnabledDebug,
+    .fuseboxEnabledRelease = ReactNativeFeatureFlagsConstexprValues::fuseboxEnabledRelease,
+    .initEagerTurboModulesOnNativeModulesQueueAndroid = ReactNativeFeatureFlagsConstexprValues::initEagerTurboModulesOnNativeModulesQueueAndroid,
+    .lazyAnimationCallbacks = ReactNativeFeatureFlagsConstexprValues::lazyAnimationCallbacks,
+    .loadVectorDrawablesOnImages = ReactNativeFeatureFlagsConstexprValues::loadVectorDrawablesOnImages,
+    .setAndroidLayoutDirection = ReactNativeFeatureFlagsConstexprValues::setAndroidLayoutDirection,
+    .traceTurboModulePromiseRejectionsOnAndroid = ReactNativeFeatureFlagsConstexprValues::traceTurboModulePromiseRejectionsOnAndroid,
+    .useAlwaysAvailableJSErrorHandling = ReactNativeFeatureFlagsConstexprValues::useAlwaysAvailableJSErrorHandling,
+    .useFabricInterop = ReactNativeFeatureFlagsConstexprValues::useFabricInterop,
+    .useImmediateExecutorInAndroidBridgeless = ReactNativeFeatureFlagsConstexprValues::useImmediateExecutorInAndroidBridgeless,
+    .useNativeViewConfigsInBridgelessMode = ReactNativeFeatureFlagsConstexprValues::useNativeViewConfigsInBridgelessMode,
+    .useOptimisedViewPreallocationOnAndroid = ReactNativeFeatureFlagsConstexprValues::useOptimisedViewPreallocationOnAndroid,
+    .useOptimizedEventBatchingOnAndroid = ReactNativeFeatureFlagsConstexprValues::useOptimizedEventBatchingOnAndroid,
+    .useRuntimeShadowNodeReferenceUpdate = ReactNativeFeatureFlagsConstexprValues::useRuntimeShadowNodeReferenceUpdate,
+    .useTurboModuleInterop = ReactNativeFeatureFlagsConstexprValues::useTurboModuleInterop,
+    .useTurboModules = ReactNativeFeatureFlagsConstexprValues::useTurboModules,
+};
+
+// Overrides can't change the flags in this mode, so debug builds check that
+// they provide the same values instead.
+void checkOverride(
+    [[maybe_unused]] std::unique_ptr<ReactNativeFeatureFlagsProvider>
+        provider) {
+#ifndef NDEBUG
+  ReactNativeFeatureFlagsAccessor accessor;
+  accessor.override(std::move(provider));
+  assert(
+      accessor.snapshot() == constexprSnapshot_ &&
+      "Feature flags must be overridden with their compile-time values");
+#endif
+}
+#else
+// Snapshots are never destroyed, as references to them can outlive a reset.
+std::vector<std::unique_ptr<const ReactNativeFeatureFlagsSnapshot>> snapshots_;
+
+std::atomic<const ReactNativeFeatureFlagsSnapshot*> snapshot_{nullptr};
+#endif
+
+} // namespace
 #pragma GCC diagnostic pop
 
+#ifndef RN_CONSTEXPR_FEATURE_FLAGS
 bool ReactNativeFeatureFlags::commonTestFlag() {
   return getAccessor().commonTestFlag();
 }
@@ -209,26 +291,69 @@ bool ReactNativeFeatureFlags::useTurboModuleInterop() {
 bool ReactNativeFeatureFlags::useTurboModules() {
   return getAccessor().useTurboModules();
 }
+#endif
+
+void ReactNativeFeatureFlags::freeze() {
+  snapshot();
+}
+
+const ReactNativeFeatureFlagsSnapshot& ReactNativeFeatureFlags::snapshot() {
+#ifdef RN_CONSTEXPR_FEATURE_FLAGS
+  return constexprSnapshot_;
+#else
+  if (auto snapshot = snapshot_.load(std::memory_order_acquire)) {
+    return *snapshot;
+  }
+
+  std::lock_guard lock(snapshotMutex_);
+  if (auto snapshot = snapshot_.load(std::memory_order_relaxed)) {
+    return *snapshot;
+  }
+
+  const auto& snapshot = snapshots_.emplace_back(
+      std::make_unique<const ReactNativeFeatureFlagsSnapshot>(
+          getAccessor().snapshot()));
+  snapshot_.store(snapshot.get(), std::memory_order_release);
+  return *snapshot;
+#endif
+}
 
 void ReactNativeFeatureFlags::override(
     std::unique_ptr<ReactNativeFeatureFlagsProvider> provider) {
+#ifdef RN_CONSTEXPR_FEATURE_FLAGS
+  checkOverride(std::move(provider));
+#else
   getAccessor().override(std::move(provider));
+#endif
 }
 
 void ReactNativeFeatureFlags::dangerouslyReset() {
+  std::lock_guard lock(snapshotMutex_);
+#ifndef RN_CONSTEXPR_FEATURE_FLAGS
+  snapshot_ = nullptr;
+#endif
   accessor_ = std::make_unique<ReactNativeFeatureFlagsAccessor>();
 }
 
 std::optional<std::string> ReactNativeFeatureFlags::dangerouslyForceOverride(
     std::unique_ptr<ReactNativeFeatureFlagsProvider> provider) {
+#ifdef RN_CONSTEXPR_FEATURE_FLAGS
+  checkOverride(std::move(provider));
+  return std::nullopt;
+#else
   auto accessor = std::make_unique<ReactNativeFeatureFlagsAccessor>();
   accessor->override(std::move(provider));
 
-  std::swap(accessor_, accessor);
+  {
+    std::lock_guard lock(snapshotMutex_);
+    snapshot_ = nullptr;
+    std::swap(accessor_, accessor);
+  }
 
   // Now accessor is the old accessor
   return accessor == nullptr ? std::nullopt
                              : accessor->getAccessedFeatureFlagNames();
+#endif
 }
 
 ReactNativeFeatureFlagsAccessor& ReactNativeFeatureFlags::getAccessor() {
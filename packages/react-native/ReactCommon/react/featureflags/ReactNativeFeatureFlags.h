@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<0c0217362f582ac635d5f46347e65252>>
+ * @generated SignedSource<<93e9ec606170e14300c84b72dad22e00>>
  */
 
 /**
@@ -29,6 +29,80 @@
 #define RN_EXPORT __attribute__((visibility("default")))
 #endif
 
+#ifdef RN_CONSTEXPR_FEATURE_FLAGS
+namespace facebook::react {
+
+/**
+ * The values of the feature flags when `RN_CONSTEXPR_FEATURE_FLAGS` is
+ * defined.
+ *
+ * Builds can change them by defining `RN_CONSTEXPR_FEATURE_FLAGS_VALUES`
+ * as the path of a header that declares
+ * `facebook::react::ReactNativeFeatureFlagsConstexprValues`, extending this
+ * struct and redeclaring the flags they set (e.g.:
+ * `static constexpr bool enableFabricRenderer = true;`).
+ */
+struct ReactNativeFeatureFlagsConstexprDefaults {
+  static constexpr bool commonTestFlag = false;
+  static constexpr bool completeReactInstanceCreationOnBgThreadOnAndroid = true;
+  static constexpr bool disableEventLoopOnBridgeless = false;
+  static constexpr bool disableMountItemReorderingAndroid = false;
+  static constexpr bool enableAlignItemsBaselineOnFabricIOS = true;
+  static constexpr bool enableAndroidLineHeightCentering = true;
+  static constexpr bool enableBridgelessArchitecture = false;
+  static constexpr bool enableCppPropsIteratorSetter = false;
+  static constexpr bool enableDeletionOfUnmountedViews = false;
+  static constexpr bool enableEagerRootViewAttachment = false;
+  static constexpr bool enableEventEmitterRetentionDuringGesturesOnAndroid = false;
+  static constexpr bool enableFabricLogs = false;
+  static constexpr bool enableFabricRenderer = false;
+  static constexpr bool enableFabricRendererExclusively = false;
+  static constexpr bool enableFixForViewCommandRace = false;
+  static constexpr bool enableGranularShadowTreeStateReconciliation = false;
+  static constexpr bool enableIOSViewClipToPaddingBox = false;
+  static constexpr bool enableLayoutAnimationsOnAndroid = false;
+  static constexpr bool enableLayoutAnimationsOnIOS = true;
+  static constexpr bool enableLongTaskAPI = false;
+  static constexpr bool enableNewBackgroundAndBorderDrawables = false;
+  static constexpr bool enablePreciseSchedulingForPremountItemsOnAndroid = false;
+  static constexpr bool enablePropsUpdateReconciliationAndroid = false;
+  static constexpr bool enableReportEventPaintTime = false;
+  static constexpr bool enableSynchronousStateUpdates = false;
+  static constexpr bool enableUIConsistency = false;
+  static constexpr bool enableViewRecycling = false;
+  static constexpr bool excludeYogaFromRawProps = false;
+  static constexpr bool fixMappingOfEventPrioritiesBetweenFabricAndReact = false;
+  static constexpr bool fixMountingCoordinatorReportedPendingTransactionsOnAndroid = false;
+  static constexpr bool fuseboxEnabledDebug = true;
+  static constexpr bool fuseboxEnabledRelease = false;
+  static constexpr bool initEagerTurboModulesOnNativeModulesQueueAndroid = true;
+  static constexpr bool lazyAnimationCallbacks = false;
+  static constexpr bool loadVectorDrawablesOnImages = false;
+  static constexpr bool setAndroidLayoutDirection = true;
+  static constexpr bool traceTurboModulePromiseRejectionsOnAndroid = false;
+  static constexpr bool useAlwaysAvailableJSErrorHandling = false;
+  static constexpr bool useFabricInterop = false;
+  static constexpr bool useImmediateExecutorInAndroidBridgeless = true;
+  static constexpr bool useNativeViewConfigsInBridgelessMode = false;
+  static constexpr bool useOptimisedViewPreallocationOnAndroid = false;
+  static constexpr bool useOptimizedEventBatchingOnAndroid = false;
+  static constexpr bool useRuntimeShadowNodeReferenceUpdate = false;
+  static constexpr bool useTurboModuleInterop = false;
+  static constexpr bool useTurboModules = false;
+};
+
+} // namespace facebook::react
+
+#ifdef RN_CONSTEXPR_FEATURE_FLAGS_VALUES
+#include RN_CONSTEXPR_FEATURE_FLAGS_VALUES
+#else
+namespace facebook::react {
+using ReactNativeFeatureFlagsConstexprValues =
+    ReactNativeFeatureFlagsConstexprDefaults;
+} // namespace facebook::react
+#endif
+#endif
+
 namespace facebook::react {
 
 /**
@@ -36,9 +110,199 @@ namespace facebook::react {
  *
  * All the methods are thread-safe (as long as the methods in the overridden
  * provider are).
+ *
+ * If `RN_CONSTEXPR_FEATURE_FLAGS` is defined, all the feature flags are
+ * compile-time constants (see `ReactNativeFeatureFlagsConstexprDefaults`),
+ * so the compiler can eliminate the code guarded by them. Overrides cannot
+ * change their values in that case.
  */
 class ReactNativeFeatureFlags {
  public:
+#ifdef RN_CONSTEXPR_FEATURE_FLAGS
+  static constexpr bool commonTestFlag() {
+    return ReactNativeFeatureFlagsConstexprValues::commonTestFlag;
+  }
+
+  static constexpr bool completeReactInstanceCreationOnBgThreadOnAndroid() {
+    return ReactNativeFeatureFlagsConstexprValues::completeReactInstanceCreationOnBgThreadOnAndroid;
+  }
+
+  static constexpr bool disableEventLoopOnBridgeless() {
+    return ReactNativeFeatureFlagsConstexprValues::disableEventLoopOnBridgeless;
+  }
+
+  static constexpr bool disableMountItemReorderingAndroid() {
+    return ReactNativeFeatureFlagsConstexprValues::disableMountItemReorderingAndroid;
+  }
+
+  static constexpr bool enableAlignItemsBaselineOnFabricIOS() {
+    return ReactNativeFeatureFlagsConstexprValues::enableAlignItemsBaselineOnFabricIOS;
+  }
+
+  static constexpr bool enableAndroidLineHeightCentering() {
+    return ReactNativeFeatureFlagsConstexprValues::enableAndroidLineHeightCentering;
+  }
+
+  static constexpr bool enableBridgelessArchitecture() {
+    return ReactNativeFeatureFlagsConstexprValues::enableBridgelessArchitecture;
+  }
+
+  static constexpr bool enableCppPropsIteratorSetter() {
+    return ReactNativeFeatureFlagsConstexprValues::enableCppPropsIteratorSetter;
+  }
+
+  static constexpr bool enableDeletionOfUnmountedViews() {
+    return ReactNativeFeatureFlagsConstexprValues::enableDeletionOfUnmountedViews;
+  }
+
+  static constexpr bool enableEagerRootViewAttachment() {
+    return ReactNativeFeatureFlagsConstexprValues::enableEagerRootViewAttachment;
+  }
+
+  static constexpr bool enableEventEmitterRetentionDuringGesturesOnAndroid() {
+    return ReactNativeFeatureFlagsConstexprValues::enableEventEmitterRetentionDuringGesturesOnAndroid;
+  }
+
+  static constexpr bool enableFabricLogs() {
+    return ReactNativeFeatureFlagsConstexprValues::enableFabricLogs;
+  }
+
+  static constexpr bool enableFabricRenderer() {
+    return ReactNativeFeatureFlagsConstexprValues::enableFabricRenderer;
+  }
+
+  static constexpr bool enableFabricRendererExclusively() {
+    return ReactNativeFeatureFlagsConstexprValues::enableFabricRendererExclusively;
+  }
+
+  static constexpr bool enableFixForViewCommandRace() {
+    return ReactNativeFeatureFlagsConstexprValues::enableFixForViewCommandRace;
+  }
+
+  static constexpr bool enableGranularShadowTreeStateReconciliation() {
+    return ReactNativeFeatureFlagsConstexprValues::enableGranularShadowTreeStateReconciliation;
+  }
+
+  static constexpr bool enableIOSViewClipToPaddingBox() {
+    return ReactNativeFeatureFlagsConstexprValues::enableIOSViewClipToPaddingBox;
+  }
+
+  static constexpr bool enableLayoutAnimationsOnAndroid() {
+    return ReactNativeFeatureFlagsConstexprValues::enableLayoutAnimationsOnAndroid;
+  }
+
+  static constexpr bool enableLayoutAnimationsOnIOS() {
+    return ReactNativeFeatureFlagsConstexprValues::enableLayoutAnimationsOnIOS;
+  }
+
+  static constexpr bool enableLongTaskAPI() {
+    return ReactNativeFeatureFlagsConstexprValues::enableLongTaskAPI;
+  }
+
+  static constexpr bool enableNewBackgroundAndBorderDrawables() {
+    return ReactNativeFeatureFlagsConstexprValues::enableNewBackgroundAndBorderDrawables;
+  }
+
+  static constexpr bool enablePreciseSchedulingForPremountItemsOnAndroid() {
+    return ReactNativeFeatureFlagsConstexprValues::enablePreciseSchedulingForPremountItemsOnAndroid;
+  }
+
+  static constexpr bool enablePropsUpdateReconciliationAndroid() {
+    return ReactNativeFeatureFlagsConstexprValues::enablePropsUpdateReconciliationAndroid;
+  }
+
+  static constexpr bool enableReportEventPaintTime() {
+    return ReactNativeFeatureFlagsConstexprValues::enableReportEventPaintTime;
+  }
+
+  static constexpr bool enableSynchronousStateUpdates() {
+    return ReactNativeFeatureFlagsConstexprValues::enableSynchronousStateUpdates;
+  }
+
+  static constexpr bool enableUIConsistency() {
+    return ReactNativeFeatureFlagsConstexprValues::enableUIConsistency;
+  }
+
+  static constexpr bool enableViewRecycling() {
+    return ReactNativeFeatureFlagsConstexprValues::enableViewRecycling;
+  }
+
+  static constexpr bool excludeYogaFromRawProps() {
+    return ReactNativeFeatureFlagsConstexprValues::excludeYogaFromRawProps;
+  }
+
+  static constexpr bool fixMappingOfEventPrioritiesBetweenFabricAndReact() {
+    return ReactNativeFeatureFlagsConstexprValues::fixMappingOfEventPrioritiesBetweenFabricAndReact;
+  }
+
+  static constexpr bool fixMountingCoordinatorReportedPendingTransactionsOnAndroid() {
+    return ReactNativeFeatureFlagsConstexprValues::fixMountingCoordinatorReportedPendingTransactionsOnAndroid;
+  }
+
+  static constexpr bool fuseboxEnabledDebug() {
+    return ReactNativeFeatureFlagsConstexprValues::fuseboxEnabledDebug;
+  }
+
+  static constexpr bool fuseboxEnabledRelease() {
+    return ReactNativeFeatureFlagsConstexprValues::fuseboxEnabledRelease;
+  }
+
+  static constexpr bool initEagerTurboModulesOnNativeModulesQueueAndroid() {
+    return ReactNativeFeatureFlagsConstexprValues::initEagerTurboModulesOnNativeModulesQueueAndroid;
+  }
+
+  static constexpr bool lazyAnimationCallbacks() {
+    return ReactNativeFeatureFlagsConstexprValues::lazyAnimationCallbacks;
+  }
+
+  static constexpr bool loadVectorDrawablesOnImages() {
+    return ReactNativeFeatureFlagsConstexprValues::loadVectorDrawablesOnImages;
+  }
+
+  static constexpr bool setAndroidLayoutDirection() {
+    return ReactNativeFeatureFlagsConstexprValues::setAndroidLayoutDirection;
+  }
+
+  static constexpr bool traceTurboModulePromiseRejectionsOnAndroid() {
+    return ReactNativeFeatureFlagsConstexprValues::traceTurboModulePromiseRejectionsOnAndroid;
+  }
+
+  static constexpr bool useAlwaysAvailableJSErrorHandling() {
+    return ReactNativeFeatureFlagsConstexprValues::useAlwaysAvailableJSErrorHandling;
+  }
+
+  static constexpr bool useFabricInterop() {
+    return ReactNativeFeatureFlagsConstexprValues::useFabricInterop;
+  }
+
+  static constexpr bool useImmediateExecutorInAndroidBridgeless() {
+    return ReactNativeFeatureFlagsConstexprValues::useImmediateExecutorInAndroidBridgeless;
+  }
+
+  static constexpr bool useNativeViewConfigsInBridgelessMode() {
+    return ReactNativeFeatureFlagsConstexprValues::useNativeViewConfigsInBridgelessMode;
+  }
+
+  static constexpr bool useOptimisedViewPreallocationOnAndroid() {
+    return ReactNativeFeatureFlagsConstexprValues::useOptimisedViewPreallocationOnAndroid;
+  }
+
+  static constexpr bool useOptimizedEventBatchingOnAndroid() {
+    return ReactNativeFeatureFlagsConstexprValues::useOptimizedEventBatchingOnAndroid;
+  }
+
+  static constexpr bool useRuntimeShadowNodeReferenceUpdate() {
+    return ReactNativeFeatureFlagsConstexprValues::useRuntimeShadowNodeReferenceUpdate;
+  }
+
+  static constexpr bool useTurboModuleInterop() {
+    return ReactNativeFeatureFlagsConstexprValues::useTurboModuleInterop;
+  }
+
+  static constexpr bool useTurboModules() {
+    return ReactNativeFeatureFlagsConstexprValues::useTurboModules;
+  }
+#else
   /**
    * Common flag for testing. Do NOT modify.
    */
@@ -268,6 +532,28 @@ class ReactNativeFeatureFlags {
    * When enabled, NativeModules will be executed by using the TurboModule system
    */
   RN_EXPORT static bool useTurboModules();
+#endif
+
+  /**
+   * Resolves all the feature flags once and makes every following access
+   * read the resolved values, without going through the provider again.
+   *
+   * Call this after overriding the feature flags, once their values are
+   * final (e.g.: after initializing the React Native runtime). The feature
+   * flags cannot be overridden after this (see `dangerouslyReset`).
+   */
+  RN_EXPORT static void freeze();
+
+  /**
+   * Returns the values of all the feature flags, freezing them if they
+   * weren't already.
+   *
+   * Code reading feature flags in hot paths (e.g.: for every node or every
+   * commit) can keep this reference and read the values from it directly.
+   * The reference stays valid after `dangerouslyReset`, but it keeps
+   * providing the values from before the reset.
+   */
+  RN_EXPORT static const ReactNativeFeatureFlagsSnapshot& snapshot();
 
   /**
    * Overrides the feature flags with the ones provided by the given provider
@@ -275,6 +561,9 @@ class ReactNativeFeatureFlags {
    *
    * This method must be called before you initialize the React Native runtime.
    *
+   * If `RN_CONSTEXPR_FEATURE_FLAGS` is defined, the provider must return the
+   * compile-time values of the flags. This is only checked in debug builds.
+   *
    * @example
    *
    * ```
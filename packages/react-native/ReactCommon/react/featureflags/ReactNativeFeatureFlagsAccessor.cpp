@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<aacc5f6cbb2cc7e0eae9beee9b6abceb>>
+ * @generated SignedSource<<d2b89216d6983e29ac37753ab9e395b4>>
  */
 
 /**
@@ -27,9 +27,12 @@ namespace facebook::react {
 
 ReactNativeFeatureFlagsAccessor::ReactNativeFeatureFlagsAccessor()
     : currentProvider_(std::make_unique<ReactNativeFeatureFlagsDefaults>()),
-      wasOverridden_(false) {}
+      wasOverridden_(false),
+      wasFrozen_(false) {}
 
 bool ReactNativeFeatureFlagsAccessor::commonTestFlag() {
+  markFlagAsAccessed(0, "commonTestFlag");
+
   auto flagValue = commonTestFlag_.load();
 
   if (!flagValue.has_value()) {
@@ -38,8 +41,6 @@ bool ReactNativeFeatureFlagsAccessor::commonTestFlag() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(0, "commonTestFlag");
-
     flagValue = currentProvider_->commonTestFlag();
     commonTestFlag_ = flagValue;
   }
@@ -48,6 +49,8 @@ bool ReactNativeFeatureFlagsAccessor::commonTestFlag() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::completeReactInstanceCreationOnBgThreadOnAndroid() {
+  markFlagAsAccessed(1, "completeReactInstanceCreationOnBgThreadOnAndroid");
+
   auto flagValue = completeReactInstanceCreationOnBgThreadOnAndroid_.load();
 
   if (!flagValue.has_value()) {
@@ -56,8 +59,6 @@ bool ReactNativeFeatureFlagsAccessor::completeReactInstanceCreationOnBgThreadOnA
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(1, "completeReactInstanceCreationOnBgThreadOnAndroid");
-
     flagValue = currentProvider_->completeReactInstanceCreationOnBgThreadOnAndroid();
     completeReactInstanceCreationOnBgThreadOnAndroid_ = flagValue;
   }
@@ -66,6 +67,8 @@ bool ReactNativeFeatureFlagsAccessor::completeReactInstanceCreationOnBgThreadOnA
 }
 
 bool ReactNativeFeatureFlagsAccessor::disableEventLoopOnBridgeless() {
+  markFlagAsAccessed(2, "disableEventLoopOnBridgeless");
+
   auto flagValue = disableEventLoopOnBridgeless_.load();
 
   if (!flagValue.has_value()) {
@@ -74,8 +77,6 @@ bool ReactNativeFeatureFlagsAccessor::disableEventLoopOnBridgeless() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(2, "disableEventLoopOnBridgeless");
-
     flagValue = currentProvider_->disableEventLoopOnBridgeless();
     disableEventLoopOnBridgeless_ = flagValue;
   }
@@ -84,6 +85,8 @@ bool ReactNativeFeatureFlagsAccessor::disableEventLoopOnBridgeless() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::disableMountItemReorderingAndroid() {
+  markFlagAsAccessed(3, "disableMountItemReorderingAndroid");
+
   auto flagValue = disableMountItemReorderingAndroid_.load();
 
   if (!flagValue.has_value()) {
@@ -92,8 +95,6 @@ bool ReactNativeFeatureFlagsAccessor::disableMountItemReorderingAndroid() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(3, "disableMountItemReorderingAndroid");
-
     flagValue = currentProvider_->disableMountItemReorderingAndroid();
     disableMountItemReorderingAndroid_ = flagValue;
   }
@@ -102,6 +103,8 @@ bool ReactNativeFeatureFlagsAccessor::disableMountItemReorderingAndroid() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::enableAlignItemsBaselineOnFabricIOS() {
+  markFlagAsAccessed(4, "enableAlignItemsBaselineOnFabricIOS");
+
   auto flagValue = enableAlignItemsBaselineOnFabricIOS_.load();
 
   if (!flagValue.has_value()) {
@@ -110,8 +113,6 @@ bool ReactNativeFeatureFlagsAccessor::enableAlignItemsBaselineOnFabricIOS() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(4, "enableAlignItemsBaselineOnFabricIOS");
-
     flagValue = currentProvider_->enableAlignItemsBaselineOnFabricIOS();
     enableAlignItemsBaselineOnFabricIOS_ = flagValue;
   }
@@ -120,6 +121,8 @@ bool ReactNativeFeatureFlagsAccessor::enableAlignItemsBaselineOnFabricIOS() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::enableAndroidLineHeightCentering() {
+  markFlagAsAccessed(5, "enableAndroidLineHeightCentering");
+
   auto flagValue = enableAndroidLineHeightCentering_.load();
 
   if (!flagValue.has_value()) {
@@ -128,8 +131,6 @@ bool ReactNativeFeatureFlagsAccessor::enableAndroidLineHeightCentering() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(5, "enableAndroidLineHeightCentering");
-
     flagValue = currentProvider_->enableAndroidLineHeightCentering();
     enableAndroidLineHeightCentering_ = flagValue;
   }
@@ -138,6 +139,8 @@ bool ReactNativeFeatureFlagsAccessor::enableAndroidLineHeightCentering() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::enableBridgelessArchitecture() {
+  markFlagAsAccessed(6, "enableBridgelessArchitecture");
+
   auto flagValue = enableBridgelessArchitecture_.load();
 
   if (!flagValue.has_value()) {
@@ -146,8 +149,6 @@ bool ReactNativeFeatureFlagsAccessor::enableBridgelessArchitecture() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(6, "enableBridgelessArchitecture");
-
     flagValue = currentProvider_->enableBridgelessArchitecture();
     enableBridgelessArchitecture_ = flagValue;
   }
@@ -156,6 +157,8 @@ bool ReactNativeFeatureFlagsAccessor::enableBridgelessArchitecture() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::enableCppPropsIteratorSetter() {
+  markFlagAsAccessed(7, "enableCppPropsIteratorSetter");
+
   auto flagValue = enableCppPropsIteratorSetter_.load();
 
   if (!flagValue.has_value()) {
@@ -164,8 +167,6 @@ bool ReactNativeFeatureFlagsAccessor::enableCppPropsIteratorSetter() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(7, "enableCppPropsIteratorSetter");
-
     flagValue = currentProvider_->enableCppPropsIteratorSetter();
     enableCppPropsIteratorSetter_ = flagValue;
   }
@@ -174,6 +175,8 @@ bool ReactNativeFeatureFlagsAccessor::enableCppPropsIteratorSetter() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::enableDeletionOfUnmountedViews() {
+  markFlagAsAccessed(8, "enableDeletionOfUnmountedViews");
+
   auto flagValue = enableDeletionOfUnmountedViews_.load();
 
   if (!flagValue.has_value()) {
@@ -182,8 +185,6 @@ bool ReactNativeFeatureFlagsAccessor::enableDeletionOfUnmountedViews() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(8, "enableDeletionOfUnmountedViews");
-
     flagValue = currentProvider_->enableDeletionOfUnmountedViews();
     enableDeletionOfUnmountedViews_ = flagValue;
   }
@@ -192,6 +193,8 @@ bool ReactNativeFeatureFlagsAccessor::enableDeletionOfUnmountedViews() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::enableEagerRootViewAttachment() {
+  markFlagAsAccessed(9, "enableEagerRootViewAttachment");
+
   auto flagValue = enableEagerRootViewAttachment_.load();
 
   if (!flagValue.has_value()) {
@@ -200,8 +203,6 @@ bool ReactNativeFeatureFlagsAccessor::enableEagerRootViewAttachment() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(9, "enableEagerRootViewAttachment");
-
     flagValue = currentProvider_->enableEagerRootViewAttachment();
     enableEagerRootViewAttachment_ = flagValue;
   }
@@ -210,6 +211,8 @@ bool ReactNativeFeatureFlagsAccessor::enableEagerRootViewAttachment() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::enableEventEmitterRetentionDuringGesturesOnAndroid() {
+  markFlagAsAccessed(10, "enableEventEmitterRetentionDuringGesturesOnAndroid");
+
   auto flagValue = enableEventEmitterRetentionDuringGesturesOnAndroid_.load();
 
   if (!flagValue.has_value()) {
@@ -218,8 +221,6 @@ bool ReactNativeFeatureFlagsAccessor::enableEventEmitterRetentionDuringGesturesO
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(10, "enableEventEmitterRetentionDuringGesturesOnAndroid");
-
     flagValue = currentProvider_->enableEventEmitterRetentionDuringGesturesOnAndroid();
     enableEventEmitterRetentionDuringGesturesOnAndroid_ = flagValue;
   }
@@ -228,6 +229,8 @@ bool ReactNativeFeatureFlagsAccessor::enableEventEmitterRetentionDuringGesturesO
 }
 
 bool ReactNativeFeatureFlagsAccessor::enableFabricLogs() {
+  markFlagAsAccessed(11, "enableFabricLogs");
+
   auto flagValue = enableFabricLogs_.load();
 
   if (!flagValue.has_value()) {
@@ -236,8 +239,6 @@ bool ReactNativeFeatureFlagsAccessor::enableFabricLogs() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(11, "enableFabricLogs");
-
     flagValue = currentProvider_->enableFabricLogs();
     enableFabricLogs_ = flagValue;
   }
@@ -246,6 +247,8 @@ bool ReactNativeFeatureFlagsAccessor::enableFabricLogs() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::enableFabricRenderer() {
+  markFlagAsAccessed(12, "enableFabricRenderer");
+
   auto flagValue = enableFabricRenderer_.load();
 
   if (!flagValue.has_value()) {
@@ -254,8 +257,6 @@ bool ReactNativeFeatureFlagsAccessor::enableFabricRenderer() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(12, "enableFabricRenderer");
-
     flagValue = currentProvider_->enableFabricRenderer();
     enableFabricRenderer_ = flagValue;
   }
@@ -264,6 +265,8 @@ bool ReactNativeFeatureFlagsAccessor::enableFabricRenderer() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::enableFabricRendererExclusively() {
+  markFlagAsAccessed(13, "enableFabricRendererExclusively");
+
   auto flagValue = enableFabricRendererExclusively_.load();
 
   if (!flagValue.has_value()) {
@@ -272,8 +275,6 @@ bool ReactNativeFeatureFlagsAccessor::enableFabricRendererExclusively() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(13, "enableFabricRendererExclusively");
-
     flagValue = currentProvider_->enableFabricRendererExclusively();
     enableFabricRendererExclusively_ = flagValue;
   }
@@ -282,6 +283,8 @@ bool ReactNativeFeatureFlagsAccessor::enableFabricRendererExclusively() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::enableFixForViewCommandRace() {
+  markFlagAsAccessed(14, "enableFixForViewCommandRace");
+
   auto flagValue = enableFixForViewCommandRace_.load();
 
   if (!flagValue.has_value()) {
@@ -290,8 +293,6 @@ bool ReactNativeFeatureFlagsAccessor::enableFixForViewCommandRace() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(14, "enableFixForViewCommandRace");
-
     flagValue = currentProvider_->enableFixForViewCommandRace();
     enableFixForViewCommandRace_ = flagValue;
   }
@@ -300,6 +301,8 @@ bool ReactNativeFeatureFlagsAccessor::enableFixForViewCommandRace() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::enableGranularShadowTreeStateReconciliation() {
+  markFlagAsAccessed(15, "enableGranularShadowTreeStateReconciliation");
+
   auto flagValue = enableGranularShadowTreeStateReconciliation_.load();
 
   if (!flagValue.has_value()) {
@@ -308,8 +311,6 @@ bool ReactNativeFeatureFlagsAccessor::enableGranularShadowTreeStateReconciliatio
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(15, "enableGranularShadowTreeStateReconciliation");
-
     flagValue = currentProvider_->enableGranularShadowTreeStateReconciliation();
     enableGranularShadowTreeStateReconciliation_ = flagValue;
   }
@@ -318,6 +319,8 @@ bool ReactNativeFeatureFlagsAccessor::enableGranularShadowTreeStateReconciliatio
 }
 
 bool ReactNativeFeatureFlagsAccessor::enableIOSViewClipToPaddingBox() {
+  markFlagAsAccessed(16, "enableIOSViewClipToPaddingBox");
+
   auto flagValue = enableIOSViewClipToPaddingBox_.load();
 
   if (!flagValue.has_value()) {
@@ -326,8 +329,6 @@ bool ReactNativeFeatureFlagsAccessor::enableIOSViewClipToPaddingBox() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(16, "enableIOSViewClipToPaddingBox");
-
     flagValue = currentProvider_->enableIOSViewClipToPaddingBox();
     enableIOSViewClipToPaddingBox_ = flagValue;
   }
@@ -336,6 +337,8 @@ bool ReactNativeFeatureFlagsAccessor::enableIOSViewClipToPaddingBox() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::enableLayoutAnimationsOnAndroid() {
+  markFlagAsAccessed(17, "enableLayoutAnimationsOnAndroid");
+
   auto flagValue = enableLayoutAnimationsOnAndroid_.load();
 
   if (!flagValue.has_value()) {
@@ -344,8 +347,6 @@ bool ReactNativeFeatureFlagsAccessor::enableLayoutAnimationsOnAndroid() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(17, "enableLayoutAnimationsOnAndroid");
-
     flagValue = currentProvider_->enableLayoutAnimationsOnAndroid();
     enableLayoutAnimationsOnAndroid_ = flagValue;
   }
@@ -354,6 +355,8 @@ bool ReactNativeFeatureFlagsAccessor::enableLayoutAnimationsOnAndroid() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::enableLayoutAnimationsOnIOS() {
+  markFlagAsAccessed(18, "enableLayoutAnimationsOnIOS");
+
   auto flagValue = enableLayoutAnimationsOnIOS_.load();
 
   if (!flagValue.has_value()) {
@@ -362,8 +365,6 @@ bool ReactNativeFeatureFlagsAccessor::enableLayoutAnimationsOnIOS() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(18, "enableLayoutAnimationsOnIOS");
-
     flagValue = currentProvider_->enableLayoutAnimationsOnIOS();
     enableLayoutAnimationsOnIOS_ = flagValue;
   }
@@ -372,6 +373,8 @@ bool ReactNativeFeatureFlagsAccessor::enableLayoutAnimationsOnIOS() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::enableLongTaskAPI() {
+  markFlagAsAccessed(19, "enableLongTaskAPI");
+
   auto flagValue = enableLongTaskAPI_.load();
 
   if (!flagValue.has_value()) {
@@ -380,8 +383,6 @@ bool ReactNativeFeatureFlagsAccessor::enableLongTaskAPI() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(19, "enableLongTaskAPI");
-
     flagValue = currentProvider_->enableLongTaskAPI();
     enableLongTaskAPI_ = flagValue;
   }
@@ -390,6 +391,8 @@ bool ReactNativeFeatureFlagsAccessor::enableLongTaskAPI() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::enableNewBackgroundAndBorderDrawables() {
+  markFlagAsAccessed(20, "enableNewBackgroundAndBorderDrawables");
+
   auto flagValue = enableNewBackgroundAndBorderDrawables_.load();
 
   if (!flagValue.has_value()) {
@@ -398,8 +401,6 @@ bool ReactNativeFeatureFlagsAccessor::enableNewBackgroundAndBorderDrawables() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(20, "enableNewBackgroundAndBorderDrawables");
-
     flagValue = currentProvider_->enableNewBackgroundAndBorderDrawables();
     enableNewBackgroundAndBorderDrawables_ = flagValue;
   }
@@ -408,6 +409,8 @@ bool ReactNativeFeatureFlagsAccessor::enableNewBackgroundAndBorderDrawables() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::enablePreciseSchedulingForPremountItemsOnAndroid() {
+  markFlagAsAccessed(21, "enablePreciseSchedulingForPremountItemsOnAndroid");
+
   auto flagValue = enablePreciseSchedulingForPremountItemsOnAndroid_.load();
 
   if (!flagValue.has_value()) {
@@ -416,8 +419,6 @@ bool ReactNativeFeatureFlagsAccessor::enablePreciseSchedulingForPremountItemsOnA
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(21, "enablePreciseSchedulingForPremountItemsOnAndroid");
-
     flagValue = currentProvider_->enablePreciseSchedulingForPremountItemsOnAndroid();
     enablePreciseSchedulingForPremountItemsOnAndroid_ = flagValue;
   }
@@ -426,6 +427,8 @@ bool ReactNativeFeatureFlagsAccessor::enablePreciseSchedulingForPremountItemsOnA
 }
 
 bool ReactNativeFeatureFlagsAccessor::enablePropsUpdateReconciliationAndroid() {
+  markFlagAsAccessed(22, "enablePropsUpdateReconciliationAndroid");
+
   auto flagValue = enablePropsUpdateReconciliationAndroid_.load();
 
   if (!flagValue.has_value()) {
@@ -434,8 +437,6 @@ bool ReactNativeFeatureFlagsAccessor::enablePropsUpdateReconciliationAndroid() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(22, "enablePropsUpdateReconciliationAndroid");
-
     flagValue = currentProvider_->enablePropsUpdateReconciliationAndroid();
     enablePropsUpdateReconciliationAndroid_ = flagValue;
   }
@@ -444,6 +445,8 @@ bool ReactNativeFeatureFlagsAccessor::enablePropsUpdateReconciliationAndroid() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::enableReportEventPaintTime() {
+  markFlagAsAccessed(23, "enableReportEventPaintTime");
+
   auto flagValue = enableReportEventPaintTime_.load();
 
   if (!flagValue.has_value()) {
@@ -452,8 +455,6 @@ bool ReactNativeFeatureFlagsAccessor::enableReportEventPaintTime() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(23, "enableReportEventPaintTime");
-
     flagValue = currentProvider_->enableReportEventPaintTime();
     enableReportEventPaintTime_ = flagValue;
   }
@@ -462,6 +463,8 @@ bool ReactNativeFeatureFlagsAccessor::enableReportEventPaintTime() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::enableSynchronousStateUpdates() {
+  markFlagAsAccessed(24, "enableSynchronousStateUpdates");
+
   auto flagValue = enableSynchronousStateUpdates_.load();
 
   if (!flagValue.has_value()) {
@@ -470,8 +473,6 @@ bool ReactNativeFeatureFlagsAccessor::enableSynchronousStateUpdates() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(24, "enableSynchronousStateUpdates");
-
     flagValue = currentProvider_->enableSynchronousStateUpdates();
     enableSynchronousStateUpdates_ = flagValue;
   }
@@ -480,6 +481,8 @@ bool ReactNativeFeatureFlagsAccessor::enableSynchronousStateUpdates() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::enableUIConsistency() {
+  markFlagAsAccessed(25, "enableUIConsistency");
+
   auto flagValue = enableUIConsistency_.load();
 
   if (!flagValue.has_value()) {
@@ -488,8 +491,6 @@ bool ReactNativeFeatureFlagsAccessor::enableUIConsistency() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(25, "enableUIConsistency");
-
     flagValue = currentProvider_->enableUIConsistency();
     enableUIConsistency_ = flagValue;
   }
@@ -498,6 +499,8 @@ bool ReactNativeFeatureFlagsAccessor::enableUIConsistency() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::enableViewRecycling() {
+  markFlagAsAccessed(26, "enableViewRecycling");
+
   auto flagValue = enableViewRecycling_.load();
 
   if (!flagValue.has_value()) {
@@ -506,8 +509,6 @@ bool ReactNativeFeatureFlagsAccessor::enableViewRecycling() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(26, "enableViewRecycling");
-
     flagValue = currentProvider_->enableViewRecycling();
     enableViewRecycling_ = flagValue;
   }
@@ -516,6 +517,8 @@ bool ReactNativeFeatureFlagsAccessor::enableViewRecycling() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::excludeYogaFromRawProps() {
+  markFlagAsAccessed(27, "excludeYogaFromRawProps");
+
   auto flagValue = excludeYogaFromRawProps_.load();
 
   if (!flagValue.has_value()) {
@@ -524,8 +527,6 @@ bool ReactNativeFeatureFlagsAccessor::excludeYogaFromRawProps() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(27, "excludeYogaFromRawProps");
-
     flagValue = currentProvider_->excludeYogaFromRawProps();
     excludeYogaFromRawProps_ = flagValue;
   }
@@ -534,6 +535,8 @@ bool ReactNativeFeatureFlagsAccessor::excludeYogaFromRawProps() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::fixMappingOfEventPrioritiesBetweenFabricAndReact() {
+  markFlagAsAccessed(28, "fixMappingOfEventPrioritiesBetweenFabricAndReact");
+
   auto flagValue = fixMappingOfEventPrioritiesBetweenFabricAndReact_.load();
 
   if (!flagValue.has_value()) {
@@ -542,8 +545,6 @@ bool ReactNativeFeatureFlagsAccessor::fixMappingOfEventPrioritiesBetweenFabricAn
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(28, "fixMappingOfEventPrioritiesBetweenFabricAndReact");
-
     flagValue = currentProvider_->fixMappingOfEventPrioritiesBetweenFabricAndReact();
     fixMappingOfEventPrioritiesBetweenFabricAndReact_ = flagValue;
   }
@@ -552,6 +553,8 @@ bool ReactNativeFeatureFlagsAccessor::fixMappingOfEventPrioritiesBetweenFabricAn
 }
 
 bool ReactNativeFeatureFlagsAccessor::fixMountingCoordinatorReportedPendingTransactionsOnAndroid() {
+  markFlagAsAccessed(29, "fixMountingCoordinatorReportedPendingTransactionsOnAndroid");
+
   auto flagValue = fixMountingCoordinatorReportedPendingTransactionsOnAndroid_.load();
 
   if (!flagValue.has_value()) {
@@ -560,8 +563,6 @@ bool ReactNativeFeatureFlagsAccessor::fixMountingCoordinatorReportedPendingTrans
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(29, "fixMountingCoordinatorReportedPendingTransactionsOnAndroid");
-
     flagValue = currentProvider_->fixMountingCoordinatorReportedPendingTransactionsOnAndroid();
     fixMountingCoordinatorReportedPendingTransactionsOnAndroid_ = flagValue;
   }
@@ -570,6 +571,8 @@ bool ReactNativeFeatureFlagsAccessor::fixMountingCoordinatorReportedPendingTrans
 }
 
 bool ReactNativeFeatureFlagsAccessor::fuseboxEnabledDebug() {
+  markFlagAsAccessed(30, "fuseboxEnabledDebug");
+
   auto flagValue = fuseboxEnabledDebug_.load();
 
   if (!flagValue.has_value()) {
@@ -578,8 +581,6 @@ bool ReactNativeFeatureFlagsAccessor::fuseboxEnabledDebug() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(30, "fuseboxEnabledDebug");
-
     flagValue = currentProvider_->fuseboxEnabledDebug();
     fuseboxEnabledDebug_ = flagValue;
   }
@@ -588,6 +589,8 @@ bool ReactNativeFeatureFlagsAccessor::fuseboxEnabledDebug() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::fuseboxEnabledRelease() {
+  markFlagAsAccessed(31, "fuseboxEnabledRelease");
+
   auto flagValue = fuseboxEnabledRelease_.load();
 
   if (!flagValue.has_value()) {
@@ -596,8 +599,6 @@ bool ReactNativeFeatureFlagsAccessor::fuseboxEnabledRelease() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(31, "fuseboxEnabledRelease");
-
     flagValue = currentProvider_->fuseboxEnabledRelease();
     fuseboxEnabledRelease_ = flagValue;
   }
@@ -606,6 +607,8 @@ bool ReactNativeFeatureFlagsAccessor::fuseboxEnabledRelease() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::initEagerTurboModulesOnNativeModulesQueueAndroid() {
+  markFlagAsAccessed(32, "initEagerTurboModulesOnNativeModulesQueueAndroid");
+
   auto flagValue = initEagerTurboModulesOnNativeModulesQueueAndroid_.load();
 
   if (!flagValue.has_value()) {
@@ -614,8 +617,6 @@ bool ReactNativeFeatureFlagsAccessor::initEagerTurboModulesOnNativeModulesQueueA
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(32, "initEagerTurboModulesOnNativeModulesQueueAndroid");
-
     flagValue = currentProvider_->initEagerTurboModulesOnNativeModulesQueueAndroid();
     initEagerTurboModulesOnNativeModulesQueueAndroid_ = flagValue;
   }
@@ -624,6 +625,8 @@ bool ReactNativeFeatureFlagsAccessor::initEagerTurboModulesOnNativeModulesQueueA
 }
 
 bool ReactNativeFeatureFlagsAccessor::lazyAnimationCallbacks() {
+  markFlagAsAccessed(33, "lazyAnimationCallbacks");
+
   auto flagValue = lazyAnimationCallbacks_.load();
 
   if (!flagValue.has_value()) {
@@ -632,8 +635,6 @@ bool ReactNativeFeatureFlagsAccessor::lazyAnimationCallbacks() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(33, "lazyAnimationCallbacks");
-
     flagValue = currentProvider_->lazyAnimationCallbacks();
     lazyAnimationCallbacks_ = flagValue;
   }
@@ -642,6 +643,8 @@ bool ReactNativeFeatureFlagsAccessor::lazyAnimationCallbacks() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::loadVectorDrawablesOnImages() {
+  markFlagAsAccessed(34, "loadVectorDrawablesOnImages");
+
   auto flagValue = loadVectorDrawablesOnImages_.load();
 
   if (!flagValue.has_value()) {
@@ -650,8 +653,6 @@ bool ReactNativeFeatureFlagsAccessor::loadVectorDrawablesOnImages() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(34, "loadVectorDrawablesOnImages");
-
     flagValue = currentProvider_->loadVectorDrawablesOnImages();
     loadVectorDrawablesOnImages_ = flagValue;
   }
@@ -660,6 +661,8 @@ bool ReactNativeFeatureFlagsAccessor::loadVectorDrawablesOnImages() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::setAndroidLayoutDirection() {
+  markFlagAsAccessed(35, "setAndroidLayoutDirection");
+
   auto flagValue = setAndroidLayoutDirection_.load();
 
   if (!flagValue.has_value()) {
@@ -668,8 +671,6 @@ bool ReactNativeFeatureFlagsAccessor::setAndroidLayoutDirection() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(35, "setAndroidLayoutDirection");
-
     flagValue = currentProvider_->setAndroidLayoutDirection();
     setAndroidLayoutDirection_ = flagValue;
   }
@@ -678,6 +679,8 @@ bool ReactNativeFeatureFlagsAccessor::setAndroidLayoutDirection() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::traceTurboModulePromiseRejectionsOnAndroid() {
+  markFlagAsAccessed(36, "traceTurboModulePromiseRejectionsOnAndroid");
+
   auto flagValue = traceTurboModulePromiseRejectionsOnAndroid_.load();
 
   if (!flagValue.has_value()) {
@@ -686,8 +689,6 @@ bool ReactNativeFeatureFlagsAccessor::traceTurboModulePromiseRejectionsOnAndroid
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(36, "traceTurboModulePromiseRejectionsOnAndroid");
-
     flagValue = currentProvider_->traceTurboModulePromiseRejectionsOnAndroid();
     traceTurboModulePromiseRejectionsOnAndroid_ = flagValue;
   }
@@ -696,6 +697,8 @@ bool ReactNativeFeatureFlagsAccessor::traceTurboModulePromiseRejectionsOnAndroid
 }
 
 bool ReactNativeFeatureFlagsAccessor::useAlwaysAvailableJSErrorHandling() {
+  markFlagAsAccessed(37, "useAlwaysAvailableJSErrorHandling");
+
   auto flagValue = useAlwaysAvailableJSErrorHandling_.load();
 
   if (!flagValue.has_value()) {
@@ -704,8 +707,6 @@ bool ReactNativeFeatureFlagsAccessor::useAlwaysAvailableJSErrorHandling() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(37, "useAlwaysAvailableJSErrorHandling");
-
     flagValue = currentProvider_->useAlwaysAvailableJSErrorHandling();
     useAlwaysAvailableJSErrorHandling_ = flagValue;
   }
@@ -714,6 +715,8 @@ bool ReactNativeFeatureFlagsAccessor::useAlwaysAvailableJSErrorHandling() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::useFabricInterop() {
+  markFlagAsAccessed(38, "useFabricInterop");
+
   auto flagValue = useFabricInterop_.load();
 
   if (!flagValue.has_value()) {
@@ -722,8 +725,6 @@ bool ReactNativeFeatureFlagsAccessor::useFabricInterop() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(38, "useFabricInterop");
-
     flagValue = currentProvider_->useFabricInterop();
     useFabricInterop_ = flagValue;
   }
@@ -732,6 +733,8 @@ bool ReactNativeFeatureFlagsAccessor::useFabricInterop() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::useImmediateExecutorInAndroidBridgeless() {
+  markFlagAsAccessed(39, "useImmediateExecutorInAndroidBridgeless");
+
   auto flagValue = useImmediateExecutorInAndroidBridgeless_.load();
 
   if (!flagValue.has_value()) {
@@ -740,8 +743,6 @@ bool ReactNativeFeatureFlagsAccessor::useImmediateExecutorInAndroidBridgeless()
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(39, "useImmediateExecutorInAndroidBridgeless");
-
     flagValue = currentProvider_->useImmediateExecutorInAndroidBridgeless();
     useImmediateExecutorInAndroidBridgeless_ = flagValue;
   }
@@ -750,6 +751,8 @@ bool ReactNativeFeatureFlagsAccessor::useImmediateExecutorInAndroidBridgeless()
 }
 
 bool ReactNativeFeatureFlagsAccessor::useNativeViewConfigsInBridgelessMode() {
+  markFlagAsAccessed(40, "useNativeViewConfigsInBridgelessMode");
+
   auto flagValue = useNativeViewConfigsInBridgelessMode_.load();
 
   if (!flagValue.has_value()) {
@@ -758,8 +761,6 @@ bool ReactNativeFeatureFlagsAccessor::useNativeViewConfigsInBridgelessMode() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(40, "useNativeViewConfigsInBridgelessMode");
-
     flagValue = currentProvider_->useNativeViewConfigsInBridgelessMode();
     useNativeViewConfigsInBridgelessMode_ = flagValue;
   }
@@ -768,6 +769,8 @@ bool ReactNativeFeatureFlagsAccessor::useNativeViewConfigsInBridgelessMode() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::useOptimisedViewPreallocationOnAndroid() {
+  markFlagAsAccessed(41, "useOptimisedViewPreallocationOnAndroid");
+
   auto flagValue = useOptimisedViewPreallocationOnAndroid_.load();
 
   if (!flagValue.has_value()) {
@@ -776,8 +779,6 @@ bool ReactNativeFeatureFlagsAccessor::useOptimisedViewPreallocationOnAndroid() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(41, "useOptimisedViewPreallocationOnAndroid");
-
     flagValue = currentProvider_->useOptimisedViewPreallocationOnAndroid();
     useOptimisedViewPreallocationOnAndroid_ = flagValue;
   }
@@ -786,6 +787,8 @@ bool ReactNativeFeatureFlagsAccessor::useOptimisedViewPreallocationOnAndroid() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::useOptimizedEventBatchingOnAndroid() {
+  markFlagAsAccessed(42, "useOptimizedEventBatchingOnAndroid");
+
   auto flagValue = useOptimizedEventBatchingOnAndroid_.load();
 
   if (!flagValue.has_value()) {
@@ -794,8 +797,6 @@ bool ReactNativeFeatureFlagsAccessor::useOptimizedEventBatchingOnAndroid() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(42, "useOptimizedEventBatchingOnAndroid");
-
     flagValue = currentProvider_->useOptimizedEventBatchingOnAndroid();
     useOptimizedEventBatchingOnAndroid_ = flagValue;
   }
@@ -804,6 +805,8 @@ bool ReactNativeFeatureFlagsAccessor::useOptimizedEventBatchingOnAndroid() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::useRuntimeShadowNodeReferenceUpdate() {
+  markFlagAsAccessed(43, "useRuntimeShadowNodeReferenceUpdate");
+
   auto flagValue = useRuntimeShadowNodeReferenceUpdate_.load();
 
   if (!flagValue.has_value()) {
@@ -812,8 +815,6 @@ bool ReactNativeFeatureFlagsAccessor::useRuntimeShadowNodeReferenceUpdate() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(43, "useRuntimeShadowNodeReferenceUpdate");
-
     flagValue = currentProvider_->useRuntimeShadowNodeReferenceUpdate();
     useRuntimeShadowNodeReferenceUpdate_ = flagValue;
   }
@@ -822,6 +823,8 @@ bool ReactNativeFeatureFlagsAccessor::useRuntimeShadowNodeReferenceUpdate() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::useTurboModuleInterop() {
+  markFlagAsAccessed(44, "useTurboModuleInterop");
+
   auto flagValue = useTurboModuleInterop_.load();
 
   if (!flagValue.has_value()) {
@@ -830,8 +833,6 @@ bool ReactNativeFeatureFlagsAccessor::useTurboModuleInterop() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(44, "useTurboModuleInterop");
-
     flagValue = currentProvider_->useTurboModuleInterop();
     useTurboModuleInterop_ = flagValue;
   }
@@ -840,6 +841,8 @@ bool ReactNativeFeatureFlagsAccessor::useTurboModuleInterop() {
 }
 
 bool ReactNativeFeatureFlagsAccessor::useTurboModules() {
+  markFlagAsAccessed(45, "useTurboModules");
+
   auto flagValue = useTurboModules_.load();
 
   if (!flagValue.has_value()) {
@@ -848,8 +851,6 @@ bool ReactNativeFeatureFlagsAccessor::useTurboModules() {
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(45, "useTurboModules");
-
     flagValue = currentProvider_->useTurboModules();
     useTurboModules_ = flagValue;
   }
@@ -857,6 +858,201 @@ bool ReactNativeFeatureFlagsAccessor::useTurboModules() {
   return flagValue.value();
 }
 
+ReactNativeFeatureFlagsSnapshot ReactNativeFeatureFlagsAccessor::snapshot() {
+  // The snapshot resolves every flag, so it doesn't mark them as accessed
+  // (that would report flags that were never read). Overrides are rejected
+  // once it exists instead.
+  wasFrozen_ = true;
+
+  if (!commonTestFlag_.load().has_value()) {
+    commonTestFlag_ = currentProvider_->commonTestFlag();
+  }
+  if (!completeReactInstanceCreationOnBgThreadOnAndroid_.load().has_value()) {
+    completeReactInstanceCreationOnBgThreadOnAndroid_ = currentProvider_->completeReactInstanceCreationOnBgThreadOnAndroid();
+  }
+  if (!disableEventLoopOnBridgeless_.load().has_value()) {
+    disableEventLoopOnBridgeless_ = currentProvider_->disableEventLoopOnBridgeless();
+  }
+  if (!disableMountItemReorderingAndroid_.load().has_value()) {
+    disableMountItemReorderingAndroid_ = currentProvider_->disableMountItemReorderingAndroid();
+  }
+  if (!enableAlignItemsBaselineOnFabricIOS_.load().has_value()) {
+    enableAlignItemsBaselineOnFabricIOS_ = currentProvider_->enableAlignItemsBaselineOnFabricIOS();
+  }
+  if (!enableAndroidLineHeightCentering_.load().has_value()) {
+    enableAndroidLineHeightCentering_ = currentProvider_->enableAndroidLineHeightCentering();
+  }
+  if (!enableBridgelessArchitecture_.load().has_value()) {
+    enableBridgelessArchitecture_ = currentProvider_->enableBridgelessArchitecture();
+  }
+  if (!enableCppPropsIteratorSetter_.load().has_value()) {
+    enableCppPropsIteratorSetter_ = currentProvider_->enableCppPropsIteratorSetter();
+  }
+  if (!enableDeletionOfUnmountedViews_.load().has_value()) {
+    enableDeletionOfUnmountedViews_ = currentProvider_->enableDeletionOfUnmountedViews();
+  }
+  if (!enableEagerRootViewAttachment_.load().has_value()) {
+    enableEagerRootViewAttachment_ = currentProvider_->enableEagerRootViewAttachment();
+  }
+  if (!enableEventEmitterRetentionDuringGesturesOnAndroid_.load().has_value()) {
+    enableEventEmitterRetentionDuringGesturesOnAndroid_ = currentProvider_->enableEventEmitterRetentionDuringGesturesOnAndroid();
+  }
+  if (!enableFabricLogs_.load().has_value()) {
+    enableFabricLogs_ = currentProvider_->enableFabricLogs();
+  }
+  if (!enableFabricRenderer_.load().has_value()) {
+    enableFabricRenderer_ = currentProvider_->enableFabricRenderer();
+  }
+  if (!enableFabricRendererExclusively_.load().has_value()) {
+    enableFabricRendererExclusively_ = currentProvider_->enableFabricRendererExclusively();
+  }
+  if (!enableFixForViewCommandRace_.load().has_value()) {
+    enableFixForViewCommandRace_ = currentProvider_->enableFixForViewCommandRace();
+  }
+  if (!enableGranularShadowTreeStateReconciliation_.load().has_value()) {
+    enableGranularShadowTreeStateReconciliation_ = currentProvider_->enableGranularShadowTreeStateReconciliation();
+  }
+  if (!enableIOSViewClipToPaddingBox_.load().has_value()) {
+    enableIOSViewClipToPaddingBox_ = currentProvider_->enableIOSViewClipToPaddingBox();
+  }
+  if (!enableLayoutAnimationsOnAndroid_.load().has_value()) {
+    enableLayoutAnimationsOnAndroid_ = currentProvider_->enableLayoutAnimationsOnAndroid();
+  }
+  if (!enableLayoutAnimationsOnIOS_.load().has_value()) {
+    enableLayoutAnimationsOnIOS_ = currentProvider_->enableLayoutAnimationsOnIOS();
+  }
+  if (!enableLongTaskAPI_.load().has_value()) {
+    enableLongTaskAPI_ = currentProvider_->enableLongTaskAPI();
+  }
+  if (!enableNewBackgroundAndBorderDrawables_.load().has_value()) {
+    enableNewBackgroundAndBorderDrawables_ = currentProvider_->enableNewBackgroundAndBorderDrawables();
+  }
+  if (!enablePreciseSchedulingForPremountItemsOnAndroid_.load().has_value()) {
+    enablePreciseSchedulingForPremountItemsOnAndroid_ = currentProvider_->enablePreciseSchedulingForPremountItemsOnAndroid();
+  }
+  if (!enablePropsUpdateReconciliationAndroid_.load().has_value()) {
+    enablePropsUpdateReconciliationAndroid_ = currentProvider_->enablePropsUpdateReconciliationAndroid();
+  }
+  if (!enableReportEventPaintTime_.load().has_value()) {
+    enableReportEventPaintTime_ = currentProvider_->enableReportEventPaintTime();
+  }
+  if (!enableSynchronousStateUpdates_.load().has_value()) {
+    enableSynchronousStateUpdates_ = currentProvider_->enableSynchronousStateUpdates();
+  }
+  if (!enableUIConsistency_.load().has_value()) {
+    enableUIConsistency_ = currentProvider_->enableUIConsistency();
+  }
+  if (!enableViewRecycling_.load().has_value()) {
+    enableViewRecycling_ = currentProvider_->enableViewRecycling();
+  }
+  if (!excludeYogaFromRawProps_.load().has_value()) {
+    excludeYogaFromRawProps_ = currentProvider_->excludeYogaFromRawProps();
+  }
+  if (!fixMappingOfEventPrioritiesBetweenFabricAndReact_.load().has_value()) {
+    fixMappingOfEventPrioritiesBetweenFabricAndReact_ = currentProvider_->fixMappingOfEventPrioritiesBetweenFabricAndReact();
+  }
+  if (!fixMountingCoordinatorReportedPendingTransactionsOnAndroid_.load().has_value()) {
+    fixMountingCoordinatorReportedPendingTransactionsOnAndroid_ = currentProvider_->fixMountingCoordinatorReportedPendingTransactionsOnAndroid();
+  }
+  if (!fuseboxEnabledDebug_.load().has_value()) {
+    fuseboxEnabledDebug_ = currentProvider_->fuseboxEnabledDebug();
+  }
+  if (!fuseboxEnabledRelease_.load().has_value()) {
+    fuseboxEnabledRelease_ = currentProvider_->fuseboxEnabledRelease();
+  }
+  if (!initEagerTurboModulesOnNativeModulesQueueAndroid_.load().has_value()) {
+    initEagerTurboModulesOnNativeModulesQueueAndroid_ = currentProvider_->initEagerTurboModulesOnNativeModulesQueueAndroid();
+  }
+  if (!lazyAnimationCallbacks_.load().has_value()) {
+    lazyAnimationCallbacks_ = currentProvider_->lazyAnimationCallbacks();
+  }
+  if (!loadVectorDrawablesOnImages_.load().has_value()) {
+    loadVectorDrawablesOnImages_ = currentProvider_->loadVectorDrawablesOnImages();
+  }
+  if (!setAndroidLayoutDirection_.load().has_value()) {
+    setAndroidLayoutDirection_ = currentProvider_->setAndroidLayoutDirection();
+  }
+  if (!traceTurboModulePromiseRejectionsOnAndroid_.load().has_value()) {
+    traceTurboModulePromiseRejectionsOnAndroid_ = currentProvider_->traceTurboModulePromiseRejectionsOnAndroid();
+  }
+  if (!useAlwaysAvailableJSErrorHandling_.load().has_value()) {
+    useAlwaysAvailableJSErrorHandling_ = currentProvider_->useAlwaysAvailableJSErrorHandling();
+  }
+  if (!useFabricInterop_.load().has_value()) {
+    useFabricInterop_ = currentProvider_->useFabricInterop();
+  }
+  if (!useImmediateExecutorInAndroidBridgeless_.load().has_value()) {
+    useImmediateExecutorInAndroidBridgeless_ = currentProvider_->useImmediateExecutorInAndroidBridgeless();
+  }
+  if (!useNativeViewConfigsInBridgelessMode_.load().has_value()) {
+    useNativeViewConfigsInBridgelessMode_ = currentProvider_->useNativeViewConfigsInBridgelessMode();
+  }
+  if (!useOptimisedViewPreallocationOnAndroid_.load().has_value()) {
+    useOptimisedViewPreallocationOnAndroid_ = currentProvider_->useOptimisedViewPreallocationOnAndroid();
+  }
+  if (!useOptimizedEventBatchingOnAndroid_.load().has_value()) {
+    useOptimizedEventBatchingOnAndroid_ = currentProvider_->useOptimizedEventBatchingOnAndroid();
+  }
+  if (!useRuntimeShadowNodeReferenceUpdate_.load().has_value()) {
+    useRuntimeShadowNodeReferenceUpdate_ = currentProvider_->useRuntimeShadowNodeReferenceUpdate();
+  }
+  if (!useTurboModuleInterop_.load().has_value()) {
+    useTurboModuleInterop_ = currentProvider_->useTurboModuleInterop();
+  }
+  if (!useTurboModules_.load().has_value()) {
+    useTurboModules_ = currentProvider_->useTurboModules();
+  }
+
+  return {
+      .commonTestFlag = commonTestFlag_.load().value(),
+      .completeReactInstanceCreationOnBgThreadOnAndroid = completeReactInstanceCreationOnBgThreadOnAndroid_.load().value(),
+      .disableEventLoopOnBridgeless = disableEventLoopOnBridgeless_.load().value(),
+      .disableMountItemReorderingAndroid = disableMountItemReorderingAndroid_.load().value(),
+      .enableAlignItemsBaselineOnFabricIOS = enableAlignItemsBaselineOnFabricIOS_.load().value(),
+      .enableAndroidLineHeightCentering = enableAndroidLineHeightCentering_.load().value(),
+      .enableBridgelessArchitecture = enableBridgelessArchitecture_.load().value(),
+      .enableCppPropsIteratorSetter = enableCppPropsIteratorSetter_.load().value(),
+      .enableDeletionOfUnmountedViews = enableDeletionOfUnmountedViews_.load().value(),
+      .enableEagerRootViewAttachment = enableEagerRootViewAttachment_.load().value(),
+      .enableEventEmitterRetentionDuringGesturesOnAndroid = enableEventEmitterRetentionDuringGesturesOnAndroid_.load().value(),
+      .enableFabricLogs = enableFabricLogs_.load().value(),
+      .enableFabricRenderer = enableFabricRenderer_.load().value(),
+      .enableFabricRendererExclusively = enableFabricRendererExclusively_.load().value(),
+      .enableFixForViewCommandRace = enableFixForViewCommandRace_.load().value(),
+      .enableGranularShadowTreeStateReconciliation = enableGranularShadowTreeStateReconciliation_.load().value(),
+      .enableIOSViewClipToPaddingBox = enableIOSViewClipToPaddingBox_.load().value(),
+      .enableLayoutAnimationsOnAndroid = enableLayoutAnimationsOnAndroid_.load().value(),
+      .enableLayoutAnimationsOnIOS = enableLayoutAnimationsOnIOS_.load().value(),
+      .enableLongTaskAPI = enableLongTaskAPI_.load().value(),
+      .enableNewBackgroundAndBorderDrawables = enableNewBackgroundAndBorderDrawables_.load().value(),
+      .enablePreciseSchedulingForPremountItemsOnAndroid = enablePreciseSchedulingForPremountItemsOnAndroid_.load().value(),
+      .enablePropsUpdateReconciliationAndroid = enablePropsUpdateReconciliationAndroid_.load().value(),
+      .enableReportEventPaintTime = enableReportEventPaintTime_.load().value(),
+      .enableSynchronousStateUpdates = enableSynchronousStateUpdates_.load().value(),
+      .enableUIConsistency = enableUIConsistency_.load().value(),
+      .enableViewRecycling = enableViewRecycling_.load().value(),
+      .excludeYogaFromRawProps = excludeYogaFromRawProps_.load().value(),
+      .fixMappingOfEventPrioritiesBetweenFabricAndReact = fixMappingOfEventPrioritiesBetweenFabricAndReact_.load().value(),
+      .fixMountingCoordinatorReportedPendingTransactionsOnAndroid = fixMountingCoordinatorReportedPendingTransactionsOnAndroid_.load().value(),
+      .fuseboxEnabledDebug = fuseboxEnabledDebug_.load().value(),
+      .fuseboxEnabledRelease = fuseboxEnabledRelease_.load().value(),
+      .initEagerTurboModulesOnNativeModulesQueueAndroid = initEagerTurboModulesOnNativeModulesQueueAndroid_.load().value(),
+      .lazyAnimationCallbacks = lazyAnimationCallbacks_.load().value(),
+      .loadVectorDrawablesOnImages = loadVectorDrawablesOnImages_.load().value(),
+      .setAndroidLayoutDirection = setAndroidLayoutDirection_.load().value(),
+      .traceTurboModulePromiseRejectionsOnAndroid = traceTurboModulePromiseRejectionsOnAndroid_.load().value(),
+      .useAlwaysAvailableJSErrorHandling = useAlwaysAvailableJSErrorHandling_.load().value(),
+      .useFabricInterop = useFabricInterop_.load().value(),
+      .useImmediateExecutorInAndroidBridgeless = useImmediateExecutorInAndroidBridgeless_.load().value(),
+      .useNativeViewConfigsInBridgelessMode = useNativeViewConfigsInBridgelessMode_.load().value(),
+      .useOptimisedViewPreallocationOnAndroid = useOptimisedViewPreallocationOnAndroid_.load().value(),
+      .useOptimizedEventBatchingOnAndroid = useOptimizedEventBatchingOnAndroid_.load().value(),
+      .useRuntimeShadowNodeReferenceUpdate = useRuntimeShadowNodeReferenceUpdate_.load().value(),
+      .useTurboModuleInterop = useTurboModuleInterop_.load().value(),
+      .useTurboModules = useTurboModules_.load().value(),
+  };
+}
+
 void ReactNativeFeatureFlagsAccessor::override(
     std::unique_ptr<ReactNativeFeatureFlagsProvider> provider) {
   if (wasOverridden_) {
@@ -864,6 +1060,11 @@ void ReactNativeFeatureFlagsAccessor::override(
         "Feature flags cannot be overridden more than once");
   }
 
+  if (wasFrozen_) {
+    throw std::runtime_error(
+        "Feature flags cannot be overridden after being frozen");
+  }
+
   ensureFlagsNotAccessed();
   wasOverridden_ = true;
   currentProvider_ = std::move(provider);
@@ -892,7 +1093,11 @@ ReactNativeFeatureFlagsAccessor::getAccessedFeatureFlagNames() const {
 void ReactNativeFeatureFlagsAccessor::markFlagAsAccessed(
     int position,
     const char* flagName) {
-  accessedFeatureFlags_[position] = flagName;
+  // Every read marks its flag, so skip the store once it's marked.
+  if (accessedFeatureFlags_[position].load(std::memory_order_relaxed) ==
+      nullptr) {
+    accessedFeatureFlags_[position] = flagName;
+  }
 }
 
 void ReactNativeFeatureFlagsAccessor::ensureFlagsNotAccessed() {
@@ -4,7 +4,7 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  *
- * @generated SignedSource<<bc9b07f2b54079d3ebb4cfd536b079bc>>
+ * @generated SignedSource<<1a67ac28dace6037c0d1ab7ca564a475>>
  */
 
 /**
@@ -28,6 +28,62 @@
 
 namespace facebook::react {
 
+/**
+ * The values of all the feature flags, resolved once so they can be read
+ * without any synchronization.
+ */
+struct ReactNativeFeatureFlagsSnapshot {
+  bool commonTestFlag;
+  bool completeReactInstanceCreationOnBgThreadOnAndroid;
+  bool disableEventLoopOnBridgeless;
+  bool disableMountItemReorderingAndroid;
+  bool enableAlignItemsBaselineOnFabricIOS;
+  bool enableAndroidLineHeightCentering;
+  bool enableBridgelessArchitecture;
+  bool enableCppPropsIteratorSetter;
+  bool enableDeletionOfUnmountedViews;
+  bool enableEagerRootViewAttachment;
+  bool enableEventEmitterRetentionDuringGesturesOnAndroid;
+  bool enableFabricLogs;
+  bool enableFabricRenderer;
+  bool enableFabricRendererExclusively;
+  bool enableFixForViewCommandRace;
+  bool enableGranularShadowTreeStateReconciliation;
+  bool enableIOSViewClipToPaddingBox;
+  bool enableLayoutAnimationsOnAndroid;
+  bool enableLayoutAnimationsOnIOS;
+  bool enableLongTaskAPI;
+  bool enableNewBackgroundAndBorderDrawables;
+  bool enablePreciseSchedulingForPremountItemsOnAndroid;
+  bool enablePropsUpdateReconciliationAndroid;
+  bool enableReportEventPaintTime;
+  bool enableSynchronousStateUpdates;
+  bool enableUIConsistency;
+  bool enableViewRecycling;
+  bool excludeYogaFromRawProps;
+  bool fixMappingOfEventPrioritiesBetweenFabricAndReact;
+  bool fixMountingCoordinatorReportedPendingTransactionsOnAndroid;
+  bool fuseboxEnabledDebug;
+  bool fuseboxEnabledRelease;
+  bool initEagerTurboModulesOnNativeModulesQueueAndroid;
+  bool lazyAnimationCallbacks;
+  bool loadVectorDrawablesOnImages;
+  bool setAndroidLayoutDirection;
+  bool traceTurboModulePromiseRejectionsOnAndroid;
+  bool useAlwaysAvailableJSErrorHandling;
+  bool useFabricInterop;
+  bool useImmediateExecutorInAndroidBridgeless;
+  bool useNativeViewConfigsInBridgelessMode;
+  bool useOptimisedViewPreallocationOnAndroid;
+  bool useOptimizedEventBatchingOnAndroid;
+  bool useRuntimeShadowNodeReferenceUpdate;
+  bool useTurboModuleInterop;
+  bool useTurboModules;
+
+  bool operator==(const ReactNativeFeatureFlagsSnapshot& other) const =
+      default;
+};
+
 class ReactNativeFeatureFlagsAccessor {
  public:
   ReactNativeFeatureFlagsAccessor();
@@ -79,6 +135,8 @@ class ReactNativeFeatureFlagsAccessor {
   bool useTurboModuleInterop();
   bool useTurboModules();
 
+  ReactNativeFeatureFlagsSnapshot snapshot();
+
   void override(std::unique_ptr<ReactNativeFeatureFlagsProvider> provider);
   std::optional<std::string> getAccessedFeatureFlagNames() const;
 
@@ -88,6 +146,7 @@ class ReactNativeFeatureFlagsAccessor {
 
   std::unique_ptr<ReactNativeFeatureFlagsProvider> currentProvider_;
   bool wasOverridden_;
+  std::atomic<bool> wasFrozen_;
 
   std::array<std::atomic<const char*>, 46> accessedFeatureFlags_;
 
@@ -34,6 +34,35 @@ class ReactNativeFeatureFlagsTest : public testing::Test {
   }
 };
 
+#ifdef RN_CONSTEXPR_FEATURE_FLAGS
+// Built with `ReactNativeFeatureFlagsTestConstexprValues.h` as the values.
+
+TEST_F(ReactNativeFeatureFlagsTest, providesCompileTimeValues) {
+  static_assert(ReactNativeFeatureFlags::commonTestFlag());
+  EXPECT_EQ(ReactNativeFeatureFlags::snapshot().commonTestFlag, true);
+}
+
+TEST_F(ReactNativeFeatureFlagsTest, acceptsOverridesWithCompileTimeValues) {
+  ReactNativeFeatureFlags::override(
+      std::make_unique<ReactNativeFeatureFlagsTestOverrides>());
+
+  auto accessedFlags = ReactNativeFeatureFlags::dangerouslyForceOverride(
+      std::make_unique<ReactNativeFeatureFlagsTestOverrides>());
+  EXPECT_EQ(accessedFlags.has_value(), false);
+
+  ReactNativeFeatureFlags::freeze();
+  EXPECT_EQ(ReactNativeFeatureFlags::snapshot().commonTestFlag, true);
+}
+
+#ifndef NDEBUG
+TEST_F(ReactNativeFeatureFlagsTest, preventsOverridingWithOtherValues) {
+  EXPECT_DEATH(
+      ReactNativeFeatureFlags::override(
+          std::make_unique<ReactNativeFeatureFlagsDefaults>()),
+      "compile-time values");
+}
+#endif
+#else
 TEST_F(ReactNativeFeatureFlagsTest, providesDefaults) {
   EXPECT_EQ(ReactNativeFeatureFlags::commonTestFlag(), false);
 }
@@ -144,4 +173,67 @@ TEST_F(
   EXPECT_EQ(accessedFlags.value(), "commonTestFlag");
 }
 
+TEST_F(ReactNativeFeatureFlagsTest, providesFrozenValues) {
+  ReactNativeFeatureFlags::override(
+      std::make_unique<ReactNativeFeatureFlagsTestOverrides>());
+
+  ReactNativeFeatureFlags::freeze();
+  EXPECT_EQ(overrideAccessCount, 1);
+
+  const auto& snapshot = ReactNativeFeatureFlags::snapshot();
+  EXPECT_EQ(&snapshot, &ReactNativeFeatureFlags::snapshot());
+  EXPECT_EQ(snapshot.commonTestFlag, true);
+
+  EXPECT_EQ(ReactNativeFeatureFlags::commonTestFlag(), true);
+  EXPECT_EQ(overrideAccessCount, 1);
+}
+
+TEST_F(ReactNativeFeatureFlagsTest, preventsOverridingAfterFreezing) {
+  ReactNativeFeatureFlags::freeze();
+
+  EXPECT_THROW(
+      ReactNativeFeatureFlags::override(
+          std::make_unique<ReactNativeFeatureFlagsTestOverrides>()),
+      std::runtime_error);
+
+  EXPECT_EQ(ReactNativeFeatureFlags::commonTestFlag(), false);
+}
+
+TEST_F(ReactNativeFeatureFlagsTest, doesNotReportFlagsOnlyReadBySnapshot) {
+  EXPECT_EQ(ReactNativeFeatureFlags::snapshot().commonTestFlag, false);
+
+  auto accessedFlags = ReactNativeFeatureFlags::dangerouslyForceOverride(
+      std::make_unique<ReactNativeFeatureFlagsTestOverrides>());
+
+  EXPECT_EQ(accessedFlags.has_value(), false);
+  EXPECT_EQ(ReactNativeFeatureFlags::snapshot().commonTestFlag, true);
+}
+
+TEST_F(ReactNativeFeatureFlagsTest, reportsFlagsReadAfterSnapshot) {
+  ReactNativeFeatureFlags::freeze();
+  EXPECT_EQ(ReactNativeFeatureFlags::commonTestFlag(), false);
+
+  auto accessedFlags = ReactNativeFeatureFlags::dangerouslyForceOverride(
+      std::make_unique<ReactNativeFeatureFlagsTestOverrides>());
+
+  EXPECT_EQ(accessedFlags.has_value(), true);
+  EXPECT_EQ(accessedFlags.value(), "commonTestFlag");
+}
+
+TEST_F(ReactNativeFeatureFlagsTest, unfreezesValuesWhenResetting) {
+  const auto& snapshot = ReactNativeFeatureFlags::snapshot();
+  EXPECT_EQ(snapshot.commonTestFlag, false);
+
+  ReactNativeFeatureFlags::dangerouslyReset();
+  ReactNativeFeatureFlags::override(
+      std::make_unique<ReactNativeFeatureFlagsTestOverrides>());
+
+  EXPECT_EQ(ReactNativeFeatureFlags::commonTestFlag(), true);
+  EXPECT_EQ(ReactNativeFeatureFlags::snapshot().commonTestFlag, true);
+
+  // Snapshots from before the reset are still valid.
+  EXPECT_EQ(snapshot.commonTestFlag, false);
+}
+#endif
+
 } // namespace facebook::react
@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+namespace facebook::react {
+
+// The compile-time feature flags for the tests built with
+// `RN_CONSTEXPR_FEATURE_FLAGS`.
+struct ReactNativeFeatureFlagsConstexprValues
+    : ReactNativeFeatureFlagsConstexprDefaults {
+  static constexpr bool commonTestFlag = true;
+};
+
+} // namespace facebook::react
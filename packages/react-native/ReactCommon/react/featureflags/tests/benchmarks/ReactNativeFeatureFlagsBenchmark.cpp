@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/featureflags/ReactNativeFeatureFlags.h>
+#include <react/featureflags/ReactNativeFeatureFlagsAccessor.h>
+
+namespace facebook::react {
+
+static void readFlagFromAccessor(benchmark::State& state) {
+  ReactNativeFeatureFlagsAccessor accessor;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(accessor.enableCppPropsIteratorSetter());
+  }
+}
+BENCHMARK(readFlagFromAccessor);
+
+static void readFlag(benchmark::State& state) {
+  ReactNativeFeatureFlags::dangerouslyReset();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        ReactNativeFeatureFlags::enableCppPropsIteratorSetter());
+  }
+}
+BENCHMARK(readFlag);
+
+static void readFlagFromSnapshot(benchmark::State& state) {
+  ReactNativeFeatureFlags::dangerouslyReset();
+  const auto& snapshot = ReactNativeFeatureFlags::snapshot();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(snapshot.enableCppPropsIteratorSetter);
+  }
+}
+BENCHMARK(readFlagFromSnapshot);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
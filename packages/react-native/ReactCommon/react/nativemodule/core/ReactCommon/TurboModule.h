@@ -68,6 +68,11 @@ class JSI_EXPORT TurboModule : public jsi::HostObject {
     return prop;
   }
 
+  // The name the module is registered with.
+  const std::string& getName() const noexcept {
+    return name_;
+  }
+
   std::vector<jsi::PropNameID> getPropertyNames(
       jsi::Runtime& runtime) override {
     std::vector<jsi::PropNameID> result;
@@ -94,6 +99,19 @@ class JSI_EXPORT TurboModule : public jsi::HostObject {
   std::unordered_map<std::string, std::shared_ptr<IAsyncEventEmitter>>
       eventEmitterMap_;
 
+  /**
+   * When enabled (typically from the constructor, next to populating
+   * `methodMap_`), every method is installed on the module's JS
+   * representation as soon as it is created, instead of lazily on first
+   * access. Subsequent lookups are then plain JS property reads that never go
+   * through the HostObject `get`/`create` path (and its UTF-8 conversion and
+   * string hashing). Worth it for modules whose methods are called at a high
+   * frequency (storage, logging).
+   */
+  void setEagerlyInstallMethods(bool eagerlyInstallMethods) noexcept {
+    eagerlyInstallMethods_ = eagerlyInstallMethods;
+  }
+
   using ArgFactory =
       std::function<void(jsi::Runtime& runtime, std::vector<jsi::Value>& args)>;
 
@@ -150,6 +168,7 @@ class JSI_EXPORT TurboModule : public jsi::HostObject {
  private:
   friend class TurboModuleBinding;
   std::unique_ptr<jsi::WeakObject> jsRepresentation_;
+  bool eagerlyInstallMethods_{false};
 };
 
 /**
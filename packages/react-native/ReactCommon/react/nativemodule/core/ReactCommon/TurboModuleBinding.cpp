@@ -158,7 +158,19 @@ jsi::Value TurboModuleBinding::getModule(
     weakJsRepresentation =
         std::make_unique<jsi::WeakObject>(runtime, jsRepresentation);
 
-    // Lazily populate the jsRepresentation, on property access.
+    if (module->eagerlyInstallMethods_) {
+      SystraceSection s(
+          "TurboModuleBinding::eagerlyInstallMethods", "module", moduleName);
+      for (const auto& propName : module->getPropertyNames(runtime)) {
+        auto prop = module->create(runtime, propName);
+        if (!prop.isUndefined()) {
+          jsRepresentation.setProperty(runtime, propName, std::move(prop));
+        }
+      }
+    }
+
+    // Lazily populate the jsRepresentation, on property access (unless the
+    // module's methods were installed eagerly above).
     //
     // How does this work?
     //   1. Initially jsRepresentation is empty: {}
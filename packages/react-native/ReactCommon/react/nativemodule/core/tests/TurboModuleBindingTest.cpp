@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <ReactCommon/TurboModule.h>
+#include <ReactCommon/TurboModuleBinding.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+
+namespace facebook::react {
+
+namespace {
+
+class TestTurboModule : public TurboModule {
+ public:
+  explicit TestTurboModule(bool eagerlyInstallMethods)
+      : TurboModule("TestModule", nullptr) {
+    methodMap_["getValue"] = MethodMetadata{
+        .argCount = 0,
+        .invoker = [](jsi::Runtime& /*runtime*/,
+                      TurboModule& /*turboModule*/,
+                      const jsi::Value* /*args*/,
+                      size_t /*count*/) { return jsi::Value{42}; }};
+    setEagerlyInstallMethods(eagerlyInstallMethods);
+  }
+
+  jsi::Value create(jsi::Runtime& runtime, const jsi::PropNameID& propName)
+      override {
+    ++createCount;
+    return TurboModule::create(runtime, propName);
+  }
+
+  int createCount{0};
+};
+
+} // namespace
+
+class TurboModuleBindingTest : public ::testing::Test {
+ protected:
+  TurboModuleBindingTest() : runtime_(hermes::makeHermesRuntime()) {}
+
+  std::shared_ptr<TestTurboModule> install(bool eagerlyInstallMethods) {
+    auto module = std::make_shared<TestTurboModule>(eagerlyInstallMethods);
+    TurboModuleBinding::install(
+        *runtime_, [module](const std::string& name) {
+          return name == "TestModule" ? module : nullptr;
+        });
+    return module;
+  }
+
+  jsi::Value eval(const std::string& js) {
+    return runtime_->global()
+        .getPropertyAsFunction(*runtime_, "eval")
+        .call(*runtime_, js);
+  }
+
+  std::unique_ptr<jsi::Runtime> runtime_;
+};
+
+TEST_F(TurboModuleBindingTest, installsMethodsLazilyByDefault) {
+  auto module = install(false);
+
+  eval("var TestModule = __turboModuleProxy('TestModule');");
+  EXPECT_EQ(module->createCount, 0);
+  EXPECT_FALSE(
+      eval("Object.prototype.hasOwnProperty.call(TestModule, 'getValue')")
+          .getBool());
+
+  EXPECT_EQ(eval("TestModule.getValue()").getNumber(), 42);
+  EXPECT_EQ(module->createCount, 1);
+  EXPECT_TRUE(
+      eval("Object.prototype.hasOwnProperty.call(TestModule, 'getValue')")
+          .getBool());
+}
+
+TEST_F(TurboModuleBindingTest, installsMethodsEagerlyAtGetModule) {
+  auto module = install(true);
+
+  eval("var TestModule = __turboModuleProxy('TestModule');");
+  EXPECT_EQ(module->createCount, 1);
+  EXPECT_TRUE(
+      eval("Object.prototype.hasOwnProperty.call(TestModule, 'getValue')")
+          .getBool());
+
+  // Calls are plain property reads on the JS representation from now on.
+  EXPECT_EQ(eval("TestModule.getValue()").getNumber(), 42);
+  EXPECT_EQ(eval("TestModule.getValue()").getNumber(), 42);
+  EXPECT_EQ(module->createCount, 1);
+}
+
+} // namespace facebook::react
@@ -108,6 +108,9 @@ std::shared_ptr<PerformanceObserver> tryGetObserver(
 
 NativePerformance::NativePerformance(std::shared_ptr<CallInvoker> jsInvoker)
     : NativePerformanceCxxSpec(std::move(jsInvoker)) {
+  // `performance.now()` and user timings are called at a high frequency, so
+  // skip the lazy HostObject lookup for them.
+  setEagerlyInstallMethods(true);
 #ifdef WITH_PERFETTO
   initializePerfetto();
 #endif
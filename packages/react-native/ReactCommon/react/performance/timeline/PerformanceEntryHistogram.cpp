@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "PerformanceEntryHistogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace facebook::react {
+
+namespace {
+
+size_t bucketIndexForDuration(DOMHighResTimeStamp duration) {
+  if (!(duration > 0)) {
+    return 0;
+  }
+  auto index = static_cast<size_t>(std::ceil(
+      std::log2(duration + 1.0) *
+      PerformanceEntryHistogram::BUCKETS_PER_OCTAVE));
+  return std::min(index, PerformanceEntryHistogram::NUM_BUCKETS - 1);
+}
+
+DOMHighResTimeStamp bucketUpperBound(size_t index) {
+  return std::exp2(
+             static_cast<double>(index) /
+             PerformanceEntryHistogram::BUCKETS_PER_OCTAVE) -
+      1.0;
+}
+
+} // namespace
+
+void PerformanceEntryHistogram::record(DOMHighResTimeStamp duration) {
+  buckets_[bucketIndexForDuration(duration)] += 1;
+  count_ += 1;
+  max_ = std::max(max_, duration);
+}
+
+DOMHighResTimeStamp PerformanceEntryHistogram::getPercentile(
+    double percentile) const {
+  if (count_ == 0) {
+    return 0;
+  }
+
+  auto rank = static_cast<uint32_t>(
+      std::ceil(std::clamp(percentile, 0.0, 100.0) / 100.0 * count_));
+  rank = std::max(rank, 1u);
+
+  uint32_t seen = 0;
+  for (size_t i = 0; i < NUM_BUCKETS; i++) {
+    seen += buckets_[i];
+    if (seen >= rank) {
+      return std::min(bucketUpperBound(i), max_);
+    }
+  }
+  return max_;
+}
+
+PerformanceEntryDurationSummary PerformanceEntryHistogram::getSummary() const {
+  return {
+      .count = count_,
+      .p50 = getPercentile(50),
+      .p95 = getPercentile(95),
+      .p99 = getPercentile(99),
+      .max = max_};
+}
+
+void PerformanceEntryHistogram::clear() {
+  buckets_.fill(0);
+  count_ = 0;
+  max_ = 0;
+}
+
+} // namespace facebook::react
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <react/timing/primitives.h>
+#include <array>
+#include <cstdint>
+
+namespace facebook::react {
+
+/**
+ * Aggregated view over the durations recorded by a
+ * `PerformanceEntryHistogram`.
+ */
+struct PerformanceEntryDurationSummary {
+  uint32_t count{0};
+  DOMHighResTimeStamp p50{0};
+  DOMHighResTimeStamp p95{0};
+  DOMHighResTimeStamp p99{0};
+  DOMHighResTimeStamp max{0};
+};
+
+/**
+ * Fixed-size log-linear histogram of durations (in milliseconds).
+ *
+ * Unlike the entry buffers, this never stores individual entries nor
+ * allocates after construction, so it can be fed continuously in production
+ * and scraped periodically without draining anything. Bucket boundaries grow
+ * geometrically (8 buckets per power of two), which bounds the relative error
+ * of any reported percentile to ~9%. Durations above ~65s are clamped into the
+ * last bucket (`max` is still exact).
+ */
+class PerformanceEntryHistogram {
+ public:
+  static constexpr size_t BUCKETS_PER_OCTAVE = 8;
+  static constexpr size_t NUM_BUCKETS = 16 * BUCKETS_PER_OCTAVE;
+
+  void record(DOMHighResTimeStamp duration);
+
+  /**
+   * Returns the (approximate) duration below which `percentile` (in the range
+   * [0, 100]) of the recorded samples fall.
+   */
+  DOMHighResTimeStamp getPercentile(double percentile) const;
+
+  PerformanceEntryDurationSummary getSummary() const;
+
+  uint32_t getCount() const {
+    return count_;
+  }
+
+  void clear();
+
+ private:
+  std::array<uint32_t, NUM_BUCKETS> buckets_{};
+  uint32_t count_{0};
+  DOMHighResTimeStamp max_{0};
+};
+
+} // namespace facebook::react
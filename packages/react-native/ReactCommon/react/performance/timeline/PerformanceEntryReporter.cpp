@@ -103,6 +103,38 @@ void PerformanceEntryReporter::getEntries(
   getBuffer(entryType).getEntries(dest, entryName);
 }
 
+std::unordered_map<std::string, PerformanceEntryDurationSummary>
+PerformanceEntryReporter::getEventDurationSummaries() const {
+  std::lock_guard lock(durationHistogramsMutex_);
+
+  std::unordered_map<std::string, PerformanceEntryDurationSummary> summaries;
+  summaries.reserve(eventDurationHistograms_.size());
+  for (const auto& [name, histogram] : eventDurationHistograms_) {
+    if (histogram.getCount() > 0) {
+      summaries.emplace(name, histogram.getSummary());
+    }
+  }
+  return summaries;
+}
+
+PerformanceEntryDurationSummary
+PerformanceEntryReporter::getLongTaskDurationSummary() const {
+  std::lock_guard lock(durationHistogramsMutex_);
+
+  return longTaskDurationHistogram_.getSummary();
+}
+
+void PerformanceEntryReporter::clearDurationSummaries() {
+  std::lock_guard lock(durationHistogramsMutex_);
+
+  // Keep the per-name histograms around, the set of event names is small and
+  // stable so this avoids reallocating them on every scrape.
+  for (auto& [_, histogram] : eventDurationHistograms_) {
+    histogram.clear();
+  }
+  longTaskDurationHistogram_.clear();
+}
+
 void PerformanceEntryReporter::clearEntries() {
   std::unique_lock lock(buffersMutex_);
 
@@ -197,6 +229,11 @@ void PerformanceEntryReporter::reportEvent(
     uint32_t interactionId) {
   eventCounts_[name]++;
 
+  if (durationSummariesEnabled_.load(std::memory_order_relaxed)) {
+    std::lock_guard lock(durationHistogramsMutex_);
+    eventDurationHistograms_[name].record(duration);
+  }
+
   if (duration < eventBuffer_.durationThreshold) {
     // The entries duration is lower than the desired reporting threshold,
     // skip
@@ -229,6 +266,11 @@ void PerformanceEntryReporter::reportLongTask(
       .startTime = startTime,
       .duration = duration};
 
+  if (durationSummariesEnabled_.load(std::memory_order_relaxed)) {
+    std::lock_guard lock(durationHistogramsMutex_);
+    longTaskDurationHistogram_.record(duration);
+  }
+
   {
     std::unique_lock lock(buffersMutex_);
     longTaskBuffer_.add(entry);
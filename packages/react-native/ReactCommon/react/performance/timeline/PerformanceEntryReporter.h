@@ -8,11 +8,15 @@
 #pragma once
 
 #include <react/timing/primitives.h>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <shared_mutex>
+#include <unordered_map>
 #include <vector>
 #include "PerformanceEntryCircularBuffer.h"
+#include "PerformanceEntryHistogram.h"
 #include "PerformanceEntryKeyedBuffer.h"
 #include "PerformanceObserverRegistry.h"
 
@@ -74,6 +78,27 @@ class PerformanceEntryReporter {
     return eventCounts_;
   }
 
+  /**
+   * Duration summaries are only recorded while enabled (off by default), so
+   * that reporting doesn't pay for the histograms when nobody scrapes them.
+   */
+  void setDurationSummariesEnabled(bool enabled) noexcept {
+    durationSummariesEnabled_.store(enabled, std::memory_order_relaxed);
+  }
+
+  /**
+   * Returns duration percentiles of all reported events, keyed by event name.
+   * Unlike `getEntries`, this accounts for events below the reporting
+   * threshold and for those already evicted from the event buffer, and it
+   * does not drain anything, so it can be scraped periodically.
+   */
+  std::unordered_map<std::string, PerformanceEntryDurationSummary>
+  getEventDurationSummaries() const;
+
+  PerformanceEntryDurationSummary getLongTaskDurationSummary() const;
+
+  void clearDurationSummaries();
+
   PerformanceEntry reportMark(
       const std::string& name,
       const std::optional<DOMHighResTimeStamp>& startTime = std::nullopt);
@@ -107,6 +132,12 @@ class PerformanceEntryReporter {
 
   std::unordered_map<std::string, uint32_t> eventCounts_;
 
+  std::atomic<bool> durationSummariesEnabled_{false};
+  mutable std::mutex durationHistogramsMutex_;
+  std::unordered_map<std::string, PerformanceEntryHistogram>
+      eventDurationHistograms_;
+  PerformanceEntryHistogram longTaskDurationHistogram_;
+
   std::function<double()> timeStampProvider_ = nullptr;
 
   double getMarkTime(const std::string& markName) const;
@@ -350,3 +350,54 @@ TEST(PerformanceEntryReporter, PerformanceEntryReporterTestClearMarks) {
     ASSERT_EQ(entries.size(), 0);
   }
 }
+
+TEST(PerformanceEntryReporter, PerformanceEntryReporterTestDurationSummaries) {
+  auto reporter = PerformanceEntryReporter::getInstance();
+  reporter->clearEntries();
+  reporter->clearDurationSummaries();
+
+  // Nothing is recorded until summaries are enabled.
+  reporter->reportEvent("click", 0, 1000, 0, 0, 0);
+  reporter->reportLongTask(0, 1000);
+  ASSERT_EQ(0, reporter->getEventDurationSummaries().size());
+  ASSERT_EQ(0, reporter->getLongTaskDurationSummary().count);
+
+  reporter->setDurationSummariesEnabled(true);
+  for (int i = 1; i <= 100; i++) {
+    reporter->reportEvent("click", 0, i, 0, 0, 0);
+  }
+  reporter->reportEvent("scroll", 0, 8, 0, 0, 0);
+  reporter->reportLongTask(0, 60);
+  reporter->reportLongTask(100, 120);
+
+  {
+    const auto summaries = reporter->getEventDurationSummaries();
+    ASSERT_EQ(2, summaries.size());
+
+    const auto& click = summaries.at("click");
+    ASSERT_EQ(100, click.count);
+    ASSERT_EQ(100, click.max);
+    ASSERT_NEAR(50, click.p50, 50 * 0.1);
+    ASSERT_NEAR(95, click.p95, 95 * 0.1);
+    ASSERT_NEAR(99, click.p99, 99 * 0.1);
+
+    const auto& scroll = summaries.at("scroll");
+    ASSERT_EQ(1, scroll.count);
+    ASSERT_EQ(8, scroll.p50);
+    ASSERT_EQ(8, scroll.max);
+
+    const auto longTasks = reporter->getLongTaskDurationSummary();
+    ASSERT_EQ(2, longTasks.count);
+    ASSERT_EQ(120, longTasks.max);
+  }
+
+  // Summaries are independent from the entry buffers.
+  reporter->clearEntries();
+  ASSERT_EQ(2, reporter->getEventDurationSummaries().size());
+
+  reporter->clearDurationSummaries();
+  ASSERT_EQ(0, reporter->getEventDurationSummaries().size());
+  ASSERT_EQ(0, reporter->getLongTaskDurationSummary().count);
+
+  reporter->setDurationSummariesEnabled(false);
+}
@@ -37,7 +37,7 @@ void ComponentDescriptorProviderRegistry::add(
       continue;
     }
 
-    registry->add(provider);
+    registry->add({provider});
   }
 }
 
@@ -71,9 +71,12 @@ ComponentDescriptorProviderRegistry::createComponentDescriptorRegistry(
   auto registry = std::make_shared<const ComponentDescriptorRegistry>(
       parameters, *this, parameters.contextContainer);
 
+  std::vector<ComponentDescriptorProvider> componentDescriptorProviders;
+  componentDescriptorProviders.reserve(componentDescriptorProviders_.size());
   for (const auto& pair : componentDescriptorProviders_) {
-    registry->add(pair.second);
+    componentDescriptorProviders.push_back(pair.second);
   }
+  registry->add(componentDescriptorProviders);
 
   componentDescriptorRegistries_.push_back(registry);
 
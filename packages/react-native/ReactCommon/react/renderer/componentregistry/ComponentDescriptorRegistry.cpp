@@ -19,112 +19,233 @@
 
 namespace facebook::react {
 
+namespace {
+
+constexpr size_t kInitialViewNameTableCapacity = 64;
+
+} // namespace
+
+ComponentDescriptorRegistry::ViewNameTable::ViewNameTable(size_t capacity)
+    : capacity(capacity),
+      slots(std::make_unique<std::atomic<const InternedViewName*>[]>(
+          capacity)) {}
+
 ComponentDescriptorRegistry::ComponentDescriptorRegistry(
     ComponentDescriptorParameters parameters,
     const ComponentDescriptorProviderRegistry& providerRegistry,
     ContextContainer::Shared contextContainer)
     : parameters_(std::move(parameters)),
       providerRegistry_(providerRegistry),
-      contextContainer_(std::move(contextContainer)) {}
+      contextContainer_(std::move(contextContainer)) {
+  publish(std::make_unique<const Snapshot>());
+  publish(std::make_unique<ViewNameTable>(kInitialViewNameTableCapacity));
+}
+
+const ComponentDescriptorRegistry::Snapshot&
+ComponentDescriptorRegistry::loadSnapshot() const {
+  return *snapshot_.load(std::memory_order_acquire);
+}
+
+void ComponentDescriptorRegistry::publish(
+    std::unique_ptr<const Snapshot> snapshot) const {
+  snapshot_.store(snapshot.get(), std::memory_order_release);
+  snapshots_.push_back(std::move(snapshot));
+}
+
+void ComponentDescriptorRegistry::publish(
+    std::unique_ptr<ViewNameTable> viewNameTable) const {
+  viewNameTable_.store(viewNameTable.get(), std::memory_order_release);
+  viewNameTables_.push_back(std::move(viewNameTable));
+}
+
+const ComponentDescriptor* ComponentDescriptorRegistry::findInternedViewName(
+    const std::string& viewName) const {
+  const auto& table = *viewNameTable_.load(std::memory_order_acquire);
+  auto mask = table.capacity - 1;
+  // The table is never more than half full, so the probing terminates.
+  for (auto index = std::hash<std::string>{}(viewName) & mask;;
+       index = (index + 1) & mask) {
+    const auto* internedViewName =
+        table.slots[index].load(std::memory_order_acquire);
+    if (internedViewName == nullptr) {
+      return nullptr;
+    }
+    if (internedViewName->viewName == viewName) {
+      return internedViewName->componentDescriptor;
+    }
+  }
+}
+
+void ComponentDescriptorRegistry::internViewName(
+    const std::string& viewName,
+    const ComponentDescriptor& componentDescriptor) const {
+  auto insert = [](ViewNameTable& table,
+                   const InternedViewName* internedViewName) {
+    auto mask = table.capacity - 1;
+    auto index = std::hash<std::string>{}(internedViewName->viewName) & mask;
+    while (table.slots[index].load(std::memory_order_relaxed) != nullptr) {
+      index = (index + 1) & mask;
+    }
+    table.slots[index].store(internedViewName, std::memory_order_release);
+    table.size++;
+  };
+
+  auto* table = viewNameTable_.load(std::memory_order_relaxed);
+  if ((table->size + 1) * 2 > table->capacity) {
+    auto grownTable = std::make_unique<ViewNameTable>(table->capacity * 2);
+    for (size_t index = 0; index < table->capacity; index++) {
+      if (auto* internedViewName =
+              table->slots[index].load(std::memory_order_relaxed)) {
+        insert(*grownTable, internedViewName);
+      }
+    }
+    table = grownTable.get();
+    publish(std::move(grownTable));
+  }
+
+  internedViewNames_.push_back(std::make_unique<const InternedViewName>(
+      InternedViewName{viewName, &componentDescriptor}));
+  insert(*table, internedViewNames_.back().get());
+}
 
 void ComponentDescriptorRegistry::add(
-    ComponentDescriptorProvider componentDescriptorProvider) const {
+    const std::vector<ComponentDescriptorProvider>&
+        componentDescriptorProviders) const {
+  if (componentDescriptorProviders.empty()) {
+    return;
+  }
+
   std::unique_lock lock(mutex_);
 
-  auto componentDescriptor = componentDescriptorProvider.constructor(
-      {parameters_.eventDispatcher,
-       parameters_.contextContainer,
-       componentDescriptorProvider.flavor});
-  react_native_assert(
-      componentDescriptor->getComponentHandle() ==
-      componentDescriptorProvider.handle);
-  react_native_assert(
-      componentDescriptor->getComponentName() ==
-      componentDescriptorProvider.name);
-
-  auto sharedComponentDescriptor = std::shared_ptr<const ComponentDescriptor>(
-      std::move(componentDescriptor));
-  _registryByHandle[componentDescriptorProvider.handle] =
-      sharedComponentDescriptor;
-  _registryByName[componentDescriptorProvider.name] = sharedComponentDescriptor;
+  auto snapshot = std::make_unique<Snapshot>(
+      *snapshot_.load(std::memory_order_relaxed));
+
+  for (const auto& componentDescriptorProvider :
+       componentDescriptorProviders) {
+    auto componentDescriptor = componentDescriptorProvider.constructor(
+        {parameters_.eventDispatcher,
+         parameters_.contextContainer,
+         componentDescriptorProvider.flavor});
+    react_native_assert(
+        componentDescriptor->getComponentHandle() ==
+        componentDescriptorProvider.handle);
+    react_native_assert(
+        componentDescriptor->getComponentName() ==
+        componentDescriptorProvider.name);
+
+    registerComponentDescriptor(
+        *snapshot,
+        std::shared_ptr<const ComponentDescriptor>(
+            std::move(componentDescriptor)));
+  }
+
+  publish(std::move(snapshot));
 }
 
 void ComponentDescriptorRegistry::registerComponentDescriptor(
+    Snapshot& snapshot,
     const SharedComponentDescriptor& componentDescriptor) const {
+  componentDescriptors_.push_back(componentDescriptor);
+
   ComponentHandle componentHandle = componentDescriptor->getComponentHandle();
-  _registryByHandle[componentHandle] = componentDescriptor;
+  snapshot.byHandle[componentHandle] = componentDescriptor.get();
 
   ComponentName componentName = componentDescriptor->getComponentName();
-  _registryByName[componentName] = componentDescriptor;
+  auto& registeredComponentDescriptor = snapshot.byName[componentName];
+  if (registeredComponentDescriptor != nullptr &&
+      viewNameTable_.load(std::memory_order_relaxed)->size != 0) {
+    // Interned view names might resolve to the replaced descriptor.
+    publish(std::make_unique<ViewNameTable>(kInitialViewNameTableCapacity));
+  }
+  registeredComponentDescriptor = componentDescriptor.get();
 }
 
 const ComponentDescriptor& ComponentDescriptorRegistry::at(
     const std::string& componentName) const {
-  std::shared_lock lock(mutex_);
+  if (auto componentDescriptor = findInternedViewName(componentName)) {
+    return *componentDescriptor;
+  }
 
+  return resolve(componentName);
+}
+
+const ComponentDescriptor& ComponentDescriptorRegistry::resolve(
+    const std::string& componentName) const {
   auto unifiedComponentName = componentNameByReactViewName(componentName);
 
-  auto it = _registryByName.find(unifiedComponentName);
-  if (it == _registryByName.end()) {
-    lock.unlock();
+  if (loadSnapshot().byName.count(unifiedComponentName) == 0) {
     providerRegistry_.request(unifiedComponentName.c_str());
-    lock.lock();
-
-    it = _registryByName.find(unifiedComponentName);
 
     /*
      * TODO: T54849676
-     * Uncomment the `assert` after the following block that checks
-     * `_fallbackComponentDescriptor` is no longer needed. The assert assumes
-     * that `componentDescriptorProviderRequest` is always not null and register
-     * some component on every single request.
+     * Assert that the component is registered at this point after the
+     * following block that checks `_fallbackComponentDescriptor` is no longer
+     * needed. The assert assumes that `componentDescriptorProviderRequest` is
+     * always not null and register some component on every single request.
      */
-    // assert(it != _registryByName.end());
   }
 
-  if (it == _registryByName.end()) {
-    auto componentDescriptor = std::make_shared<
+  std::unique_lock lock(mutex_);
+
+  if (auto componentDescriptor = findInternedViewName(componentName)) {
+    // Another thread has interned the name in the meantime.
+    return *componentDescriptor;
+  }
+
+  const auto* componentDescriptor = [&]() {
+    const auto& byName = snapshot_.load(std::memory_order_relaxed)->byName;
+    auto it = byName.find(unifiedComponentName);
+    return it != byName.end() ? it->second : nullptr;
+  }();
+
+  if (componentDescriptor == nullptr) {
+    auto snapshot = std::make_unique<Snapshot>(
+        *snapshot_.load(std::memory_order_relaxed));
+    auto legacyComponentDescriptor = std::make_shared<
         const UnstableLegacyViewManagerAutomaticComponentDescriptor>(
         parameters_, unifiedComponentName);
-    registerComponentDescriptor(componentDescriptor);
-    return *_registryByName.find(unifiedComponentName)->second;
+    componentDescriptor = legacyComponentDescriptor.get();
+    registerComponentDescriptor(*snapshot, legacyComponentDescriptor);
+    publish(std::move(snapshot));
   }
 
-  return *it->second;
+  internViewName(componentName, *componentDescriptor);
+
+  return *componentDescriptor;
 }
 
 const ComponentDescriptor* ComponentDescriptorRegistry::
     findComponentDescriptorByHandle_DO_NOT_USE_THIS_IS_BROKEN(
         ComponentHandle componentHandle) const {
-  std::shared_lock lock(mutex_);
-
-  auto iterator = _registryByHandle.find(componentHandle);
-  if (iterator == _registryByHandle.end()) {
+  const auto& byHandle = loadSnapshot().byHandle;
+  auto iterator = byHandle.find(componentHandle);
+  if (iterator == byHandle.end()) {
     return nullptr;
   }
 
-  return iterator->second.get();
+  return iterator->second;
 }
 
 const ComponentDescriptor& ComponentDescriptorRegistry::at(
     ComponentHandle componentHandle) const {
-  std::shared_lock lock(mutex_);
-
-  return *_registryByHandle.at(componentHandle);
+  return *loadSnapshot().byHandle.at(componentHandle);
 }
 
 bool ComponentDescriptorRegistry::hasComponentDescriptorAt(
     ComponentHandle componentHandle) const {
-  std::shared_lock lock(mutex_);
-
-  auto iterator = _registryByHandle.find(componentHandle);
-  return iterator != _registryByHandle.end();
+  return loadSnapshot().byHandle.count(componentHandle) != 0;
 }
 
 void ComponentDescriptorRegistry::setFallbackComponentDescriptor(
     const SharedComponentDescriptor& descriptor) {
+  std::unique_lock lock(mutex_);
+
   _fallbackComponentDescriptor = descriptor;
-  registerComponentDescriptor(descriptor);
+
+  auto snapshot = std::make_unique<Snapshot>(
+      *snapshot_.load(std::memory_order_relaxed));
+  registerComponentDescriptor(*snapshot, descriptor);
+  publish(std::move(snapshot));
 }
 
 ComponentDescriptor::Shared
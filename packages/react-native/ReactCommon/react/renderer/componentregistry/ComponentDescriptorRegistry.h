@@ -7,9 +7,12 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
-#include <shared_mutex>
+#include <mutex>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <react/renderer/componentregistry/ComponentDescriptorProvider.h>
 #include <react/renderer/core/ComponentDescriptor.h>
@@ -26,6 +29,12 @@ using SharedComponentDescriptorRegistry =
 
 /*
  * Registry of particular `ComponentDescriptor`s.
+ * Lookups don't lock: they read an immutable snapshot of the registry which
+ * is replaced (copied and modified) on every registration. Registrations are
+ * rare (mostly happen during startup and the first render of every component)
+ * while lookups happen for every created or cloned node.
+ * View names coming from JS are interned in a separate append-only table, so
+ * interning a name doesn't copy the snapshot.
  */
 class ComponentDescriptorRegistry {
  public:
@@ -61,23 +70,102 @@ class ComponentDescriptorRegistry {
  private:
   friend class ComponentDescriptorProviderRegistry;
 
+  /*
+   * Immutable state of the registry. Descriptors are owned by
+   * `componentDescriptors_`.
+   */
+  struct Snapshot {
+    std::unordered_map<ComponentHandle, const ComponentDescriptor*> byHandle;
+    std::unordered_map<std::string, const ComponentDescriptor*> byName;
+  };
+
+  /*
+   * A name requested through `at(const std::string&)` (as it comes from JS,
+   * before `componentNameByReactViewName`) and the descriptor it resolves to.
+   */
+  struct InternedViewName {
+    std::string viewName;
+    const ComponentDescriptor* componentDescriptor;
+  };
+
+  /*
+   * Open-addressing hash table of interned view names. Slots are only ever
+   * filled (under `mutex_`), so lookups can probe them without locking. The
+   * table is replaced by a twice larger one when it gets half full.
+   */
+  struct ViewNameTable {
+    explicit ViewNameTable(size_t capacity);
+
+    const size_t capacity; // A power of two.
+    const std::unique_ptr<std::atomic<const InternedViewName*>[]> slots;
+    size_t size{0}; // Guarded by `mutex_`.
+  };
+
+  const Snapshot& loadSnapshot() const;
+
+  /*
+   * Returns the descriptor `viewName` was interned to, or `nullptr`.
+   */
+  const ComponentDescriptor* findInternedViewName(
+      const std::string& viewName) const;
+
+  /*
+   * Resolves `componentName` and interns it, registering the descriptor on
+   * demand. Slow path of `at(const std::string&)`.
+   */
+  const ComponentDescriptor& resolve(const std::string& componentName) const;
+
+  /*
+   * Must be called with `mutex_` held.
+   */
   void registerComponentDescriptor(
+      Snapshot& snapshot,
       const SharedComponentDescriptor& componentDescriptor) const;
+  void publish(std::unique_ptr<const Snapshot> snapshot) const;
+  void internViewName(
+      const std::string& viewName,
+      const ComponentDescriptor& componentDescriptor) const;
+  void publish(std::unique_ptr<ViewNameTable> viewNameTable) const;
 
   /*
-   * Creates a `ComponentDescriptor` using specified
-   * `ComponentDescriptorProvider` and stored `ComponentDescriptorParameters`,
-   * and then adds that to the registry.
+   * Creates `ComponentDescriptor`s using specified
+   * `ComponentDescriptorProvider`s and stored `ComponentDescriptorParameters`,
+   * and then adds them to the registry.
    * To be used by `ComponentDescriptorProviderRegistry` only.
    * Thread safe.
    */
-  void add(ComponentDescriptorProvider componentDescriptorProvider) const;
+  void add(const std::vector<ComponentDescriptorProvider>&
+               componentDescriptorProviders) const;
+
+  /*
+   * Guards all the mutable state below except `snapshot_` and
+   * `viewNameTable_` (and its slots); lookups read those without it.
+   */
+  mutable std::mutex mutex_;
+  mutable std::atomic<const Snapshot*> snapshot_;
+  mutable std::atomic<ViewNameTable*> viewNameTable_;
+
+  /*
+   * All published snapshots. Replaced snapshots are never deallocated because
+   * lookups might still read them; there are few registrations and the
+   * snapshots only store pointers, so it costs little.
+   */
+  mutable std::vector<std::unique_ptr<const Snapshot>> snapshots_;
+
+  /*
+   * All published view name tables and interned names, kept for the same
+   * reason. Tables grow geometrically, so they take at most twice the memory
+   * of the current one (plus one table per replaced descriptor).
+   */
+  mutable std::vector<std::unique_ptr<ViewNameTable>> viewNameTables_;
+  mutable std::vector<std::unique_ptr<const InternedViewName>>
+      internedViewNames_;
+
+  /*
+   * All registered descriptors, including replaced ones for the same reason.
+   */
+  mutable std::vector<SharedComponentDescriptor> componentDescriptors_;
 
-  mutable std::shared_mutex mutex_;
-  mutable std::unordered_map<ComponentHandle, SharedComponentDescriptor>
-      _registryByHandle;
-  mutable std::unordered_map<std::string, SharedComponentDescriptor>
-      _registryByName;
   ComponentDescriptor::Shared _fallbackComponentDescriptor;
   ComponentDescriptorParameters parameters_{};
   const ComponentDescriptorProviderRegistry& providerRegistry_;
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/componentregistry/ComponentDescriptorProviderRegistry.h>
+#include <react/renderer/components/root/RootComponentDescriptor.h>
+#include <react/renderer/components/view/ViewComponentDescriptor.h>
+
+namespace facebook::react {
+
+namespace {
+
+ComponentDescriptorRegistry::Shared createRegistry(
+    const ComponentDescriptorProviderRegistry& providerRegistry) {
+  return providerRegistry.createComponentDescriptorRegistry(
+      ComponentDescriptorParameters{
+          EventDispatcher::Shared{}, nullptr, nullptr});
+}
+
+} // namespace
+
+TEST(ComponentDescriptorRegistryTest, resolvesReactViewNames) {
+  ComponentDescriptorProviderRegistry providerRegistry{};
+  providerRegistry.add(
+      concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+  auto registry = createRegistry(providerRegistry);
+
+  const auto& viewComponentDescriptor = registry->at(ViewShadowNode::Handle());
+  EXPECT_EQ(&registry->at("View"), &viewComponentDescriptor);
+  EXPECT_EQ(&registry->at("RCTView"), &viewComponentDescriptor);
+  EXPECT_EQ(&registry->at("ScrollContentView"), &viewComponentDescriptor);
+
+  // Interned names resolve to the same descriptors.
+  EXPECT_EQ(&registry->at("RCTView"), &viewComponentDescriptor);
+  EXPECT_EQ(&registry->at("View"), &viewComponentDescriptor);
+}
+
+TEST(ComponentDescriptorRegistryTest, requestsMissingComponents) {
+  ComponentDescriptorProviderRegistry providerRegistry{};
+  auto registry = createRegistry(providerRegistry);
+
+  std::vector<std::string> requestedComponentNames;
+  providerRegistry.setComponentDescriptorProviderRequest(
+      [&](ComponentName componentName) {
+        requestedComponentNames.emplace_back(componentName);
+        providerRegistry.add(
+            concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+      });
+
+  EXPECT_FALSE(registry->hasComponentDescriptorAt(ViewShadowNode::Handle()));
+
+  const auto& viewComponentDescriptor = registry->at("RCTView");
+  EXPECT_EQ(&registry->at(ViewShadowNode::Handle()), &viewComponentDescriptor);
+  EXPECT_EQ(&registry->at("RCTView"), &viewComponentDescriptor);
+  EXPECT_EQ(requestedComponentNames, std::vector<std::string>{"View"});
+}
+
+TEST(ComponentDescriptorRegistryTest, replacesInternedNames) {
+  ComponentDescriptorProviderRegistry providerRegistry{};
+  auto registry = createRegistry(providerRegistry);
+
+  // Unknown components are backed by legacy view managers.
+  const auto& legacyComponentDescriptor = registry->at("RCTView");
+  EXPECT_EQ(legacyComponentDescriptor.getComponentName(), std::string("View"));
+  EXPECT_FALSE(registry->hasComponentDescriptorAt(ViewShadowNode::Handle()));
+
+  providerRegistry.add(
+      concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+
+  EXPECT_EQ(&registry->at("RCTView"), &registry->at(ViewShadowNode::Handle()));
+}
+
+TEST(ComponentDescriptorRegistryTest, internsManyNames) {
+  ComponentDescriptorProviderRegistry providerRegistry{};
+  auto registry = createRegistry(providerRegistry);
+
+  // Enough names to outgrow the initial table of interned names a few times.
+  std::vector<const ComponentDescriptor*> componentDescriptors;
+  for (int i = 0; i < 500; i++) {
+    componentDescriptors.push_back(
+        &registry->at("RCTLegacyView" + std::to_string(i)));
+  }
+
+  for (int i = 0; i < 500; i++) {
+    const auto& componentDescriptor =
+        registry->at("RCTLegacyView" + std::to_string(i));
+    EXPECT_EQ(&componentDescriptor, componentDescriptors[i]);
+    EXPECT_EQ(
+        componentDescriptor.getComponentName(),
+        "LegacyView" + std::to_string(i));
+  }
+}
+
+TEST(ComponentDescriptorRegistryTest, concurrentLookupsAndRegistrations) {
+  ComponentDescriptorProviderRegistry providerRegistry{};
+  providerRegistry.add(
+      concreteComponentDescriptorProvider<ViewComponentDescriptor>());
+  auto registry = createRegistry(providerRegistry);
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; i++) {
+    threads.emplace_back([&] {
+      for (int j = 0; j < 1000; j++) {
+        EXPECT_EQ(
+            registry->at("RCTView").getComponentHandle(),
+            ViewShadowNode::Handle());
+      }
+    });
+  }
+  providerRegistry.add(
+      concreteComponentDescriptorProvider<RootComponentDescriptor>());
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_TRUE(registry->hasComponentDescriptorAt(RootShadowNode::Handle()));
+}
+
+} // namespace facebook::react
@@ -37,6 +37,16 @@ Transform RootShadowNode::getTransform() const {
   return Transform::Translate(viewportOffset.x, viewportOffset.y, 0);
 }
 
+void RootShadowNode::enableRelativeLayoutMetricsCache() const {
+  relativeLayoutMetricsCache_.enable();
+}
+
+RelativeLayoutMetricsCache* RootShadowNode::getRelativeLayoutMetricsCache()
+    const {
+  return relativeLayoutMetricsCache_.isEnabled() ? &relativeLayoutMetricsCache_
+                                                 : nullptr;
+}
+
 RootShadowNode::Unshared RootShadowNode::clone(
     const PropsParserContext& propsParserContext,
     const LayoutConstraints& layoutConstraints,
@@ -13,6 +13,7 @@
 #include <react/renderer/components/view/ConcreteViewShadowNode.h>
 #include <react/renderer/core/LayoutContext.h>
 #include <react/renderer/core/PropsParserContext.h>
+#include <react/renderer/core/RelativeLayoutMetricsCache.h>
 
 namespace facebook::react {
 
@@ -56,6 +57,18 @@ class RootShadowNode final
       const LayoutContext& layoutContext) const;
 
   Transform getTransform() const override;
+
+  /*
+   * Enables memoization of layout metrics computed relatively to this node.
+   * Must only be called once the tree is laid out and sealed (i.e. when it
+   * becomes a committed revision).
+   */
+  void enableRelativeLayoutMetricsCache() const;
+
+  RelativeLayoutMetricsCache* getRelativeLayoutMetricsCache() const override;
+
+ private:
+  mutable RelativeLayoutMetricsCache relativeLayoutMetricsCache_;
 };
 
 } // namespace facebook::react
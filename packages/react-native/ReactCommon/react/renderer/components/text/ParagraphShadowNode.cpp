@@ -16,6 +16,7 @@
 #include <react/renderer/graphics/rounding.h>
 #include <react/renderer/telemetry/TransactionTelemetry.h>
 #include <react/renderer/textlayoutmanager/TextLayoutContext.h>
+#include <react/renderer/textlayoutmanager/TextMeasureCache.h>
 
 #include "ParagraphState.h"
 
@@ -31,39 +32,133 @@ ParagraphShadowNode::ParagraphShadowNode(
     : ConcreteViewShadowNode(sourceShadowNode, fragment) {
   auto& sourceParagraphShadowNode =
       static_cast<const ParagraphShadowNode&>(sourceShadowNode);
-  if (!fragment.children && !fragment.props &&
-      sourceParagraphShadowNode.getIsLayoutClean()) {
-    // This ParagraphShadowNode was cloned but did not change
-    // in a way that affects its layout. Let's mark it clean
-    // to stop Yoga from traversing it.
-    cleanLayout();
+  if (!fragment.children && !fragment.props) {
+    // Neither props nor children changed, so the content built for the source
+    // node (if any) is still valid.
+    content_ = sourceParagraphShadowNode.content_;
+
+    if (sourceParagraphShadowNode.getIsLayoutClean()) {
+      // This ParagraphShadowNode was cloned but did not change
+      // in a way that affects its layout. Let's mark it clean
+      // to stop Yoga from traversing it.
+      cleanLayout();
+    }
+    return;
+  }
+
+  if (!fragment.state && sourceParagraphShadowNode.getIsLayoutClean()) {
+    updateContentIfDecorationOnlyChange(sourceParagraphShadowNode);
   }
 }
 
-const Content& ParagraphShadowNode::getContent(
-    const LayoutContext& layoutContext) const {
-  if (content_.has_value()) {
-    return content_.value();
+void ParagraphShadowNode::updateContentIfDecorationOnlyChange(
+    const ParagraphShadowNode& sourceParagraphShadowNode) {
+  const auto& sourceContent = sourceParagraphShadowNode.content_;
+  if (!sourceContent || !sourceContent->attachments.empty() ||
+      !sourceParagraphShadowNode.textLayoutManager_) {
+    // Attachments are measured during layout and stored in the state, so we
+    // can't reuse the layout of paragraphs which have them.
+    return;
   }
 
-  ensureUnsealed();
+  if (getChildren().empty()) {
+    // Clones with empty children are usually filled with `appendChild` right
+    // after (e.g. `cloneNodeWithNewChildren`), so there's nothing to compare.
+    return;
+  }
+
+  const auto& sourceProps = sourceParagraphShadowNode.getConcreteProps();
+  const auto& props = getConcreteProps();
+  if (&sourceProps != &props &&
+      !(sourceProps.yogaStyle == props.yogaStyle &&
+        sourceProps.paragraphAttributes == props.paragraphAttributes &&
+        sourceProps.onTextLayout == props.onTextLayout)) {
+    return;
+  }
+
+  const auto& sourceBaseTextAttributes =
+      sourceContent->attributedString.getBaseTextAttributes();
+  auto content = buildContent(
+      getBaseTextAttributes(sourceBaseTextAttributes.fontSizeMultiplier));
+  const auto& baseTextAttributes =
+      content.attributedString.getBaseTextAttributes();
+
+  if (!content.attachments.empty() ||
+      baseTextAttributes.layoutDirection !=
+          sourceBaseTextAttributes.layoutDirection ||
+      !areTextAttributesEquivalentLayoutWise(
+          baseTextAttributes, sourceBaseTextAttributes) ||
+      !areAttributedStringsEquivalentLayoutWise(
+          content.attributedString, sourceContent->attributedString)) {
+    return;
+  }
 
+  // Only decorative aspects of the text changed: the existing measurement and
+  // layout remain valid, but the new content still has to reach the mounting
+  // layer through the state because `layout` won't be called for the node.
+  textLayoutManager_ = sourceParagraphShadowNode.textLayoutManager_;
+  content_ = std::make_shared<const Content>(std::move(content));
+  updateStateIfNeeded(*content_);
+  cleanLayout();
+}
+
+void ParagraphShadowNode::appendChild(const ShadowNode::Shared& child) {
+  ConcreteViewShadowNode::appendChild(child);
+  // The content is built from the children, so it has to be built (and
+  // measured) again.
+  content_.reset();
+  dirtyLayout();
+}
+
+void ParagraphShadowNode::replaceChild(
+    const ShadowNode& oldChild,
+    const ShadowNode::Shared& newChild,
+    size_t suggestedIndex) {
+  ConcreteViewShadowNode::replaceChild(oldChild, newChild, suggestedIndex);
+  content_.reset();
+  dirtyLayout();
+}
+
+TextAttributes ParagraphShadowNode::getBaseTextAttributes(
+    Float fontSizeMultiplier) const {
   auto textAttributes = TextAttributes::defaultTextAttributes();
-  textAttributes.fontSizeMultiplier = layoutContext.fontSizeMultiplier;
+  textAttributes.fontSizeMultiplier = fontSizeMultiplier;
   textAttributes.apply(getConcreteProps().textAttributes);
   textAttributes.layoutDirection =
       YGNodeLayoutGetDirection(&yogaNode_) == YGDirectionRTL
       ? LayoutDirection::RightToLeft
       : LayoutDirection::LeftToRight;
+  return textAttributes;
+}
+
+Content ParagraphShadowNode::buildContent(
+    const TextAttributes& baseTextAttributes) const {
   auto attributedString = AttributedString{};
   auto attachments = Attachments{};
-  buildAttributedString(textAttributes, *this, attributedString, attachments);
-  attributedString.setBaseTextAttributes(textAttributes);
+  buildAttributedString(
+      baseTextAttributes, *this, attributedString, attachments);
+  attributedString.setBaseTextAttributes(baseTextAttributes);
+
+  return Content{
+      std::move(attributedString),
+      getConcreteProps().paragraphAttributes,
+      std::move(attachments)};
+}
+
+const Content& ParagraphShadowNode::getContent(
+    const LayoutContext& layoutContext) const {
+  auto textAttributes = getBaseTextAttributes(layoutContext.fontSizeMultiplier);
+
+  if (content_ &&
+      content_->attributedString.getBaseTextAttributes() == textAttributes) {
+    return *content_;
+  }
+
+  ensureUnsealed();
 
-  content_ = Content{
-      attributedString, getConcreteProps().paragraphAttributes, attachments};
+  content_ = std::make_shared<const Content>(buildContent(textAttributes));
 
-  return content_.value();
+  return *content_;
 }
 
 Content ParagraphShadowNode::getContentWithMeasuredAttachments(
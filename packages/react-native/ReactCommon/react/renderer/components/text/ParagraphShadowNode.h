@@ -62,6 +62,14 @@ class ParagraphShadowNode final : public ConcreteViewShadowNode<
   void setTextLayoutManager(
       std::shared_ptr<const TextLayoutManager> textLayoutManager);
 
+#pragma mark - ShadowNode
+
+  void appendChild(const ShadowNode::Shared& child) override;
+  void replaceChild(
+      const ShadowNode& oldChild,
+      const ShadowNode::Shared& newChild,
+      size_t suggestedIndex = SIZE_MAX) override;
+
 #pragma mark - LayoutableShadowNode
 
   void layout(LayoutContext layoutContext) override;
@@ -89,6 +97,24 @@ class ParagraphShadowNode final : public ConcreteViewShadowNode<
    */
   const Content& getContent(const LayoutContext& layoutContext) const;
 
+  /*
+   * Returns text attributes which all fragments of the content inherit.
+   */
+  TextAttributes getBaseTextAttributes(Float fontSizeMultiplier) const;
+
+  /*
+   * Builds a `Content` object from the nested text nodes.
+   */
+  Content buildContent(const TextAttributes& baseTextAttributes) const;
+
+  /*
+   * If the node differs from `sourceParagraphShadowNode` only in decorative
+   * aspects of the text (such as colors), updates the content and the state
+   * and keeps the layout (and the measurement it's based on) clean.
+   */
+  void updateContentIfDecorationOnlyChange(
+      const ParagraphShadowNode& sourceParagraphShadowNode);
+
   /*
    * Builds and returns a `Content` object with given `layoutConstraints`.
    */
@@ -106,8 +132,11 @@ class ParagraphShadowNode final : public ConcreteViewShadowNode<
 
   /*
    * Cached content of the subtree started from the node.
+   * Shared between clones which have the same props and children.
    */
-  mutable std::optional<Content> content_{};
+  mutable std::shared_ptr<const Content> content_{};
+
+  friend class ParagraphShadowNodeTest;
 };
 
 } // namespace facebook::react
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+
+namespace facebook::react {
+
+class ParagraphShadowNodeTest : public ::testing::Test {
+ protected:
+  ParagraphShadowNodeTest() : builder_(simpleComponentBuilder()) {
+    auto rawTextProps = std::make_shared<RawTextProps>();
+    rawTextProps->text = "Hello";
+
+    // clang-format off
+    auto element =
+        Element<RootShadowNode>()
+          .reference(rootShadowNode_)
+          .props([] {
+            auto sharedProps = std::make_shared<RootProps>();
+            sharedProps->layoutConstraints =
+                LayoutConstraints{{0, 0}, {500, 500}};
+            return sharedProps;
+          })
+          .children({
+            Element<ParagraphShadowNode>()
+              .reference(paragraphShadowNode_)
+              .children({
+                Element<TextShadowNode>()
+                  .reference(textShadowNode_)
+                  .children({
+                    Element<RawTextShadowNode>()
+                      .reference(rawTextShadowNode_)
+                      .props(rawTextProps)
+                  })
+              })
+          });
+    // clang-format on
+
+    builder_.build(element);
+    rootShadowNode_->layoutIfNeeded();
+  }
+
+  static const ParagraphShadowNode::Content* getContent(
+      const ParagraphShadowNode& paragraphShadowNode) {
+    return paragraphShadowNode.content_.get();
+  }
+
+  // Clones the paragraph the way React does after the inner text node was
+  // cloned with `fragment`.
+  std::shared_ptr<const ParagraphShadowNode> cloneWithTextFragment(
+      const ShadowNodeFragment& fragment) {
+    auto textShadowNode = textShadowNode_->clone(fragment);
+    return std::static_pointer_cast<const ParagraphShadowNode>(
+        paragraphShadowNode_->clone(
+            {.children = std::make_shared<const ShadowNode::ListOfShared>(
+                 ShadowNode::ListOfShared{textShadowNode})}));
+  }
+
+  ComponentBuilder builder_;
+  std::shared_ptr<RootShadowNode> rootShadowNode_;
+  std::shared_ptr<ParagraphShadowNode> paragraphShadowNode_;
+  std::shared_ptr<TextShadowNode> textShadowNode_;
+  std::shared_ptr<RawTextShadowNode> rawTextShadowNode_;
+};
+
+TEST_F(ParagraphShadowNodeTest, clonesShareContent) {
+  ASSERT_TRUE(paragraphShadowNode_->getIsLayoutClean());
+  const auto* content = getContent(*paragraphShadowNode_);
+  ASSERT_NE(content, nullptr);
+
+  auto clonedShadowNode = std::static_pointer_cast<const ParagraphShadowNode>(
+      paragraphShadowNode_->clone({}));
+
+  EXPECT_EQ(getContent(*clonedShadowNode), content);
+  EXPECT_TRUE(clonedShadowNode->getIsLayoutClean());
+}
+
+TEST_F(ParagraphShadowNodeTest, decorationOnlyChangeKeepsLayoutClean) {
+  auto textProps = std::make_shared<TextProps>();
+  textProps->textAttributes.foregroundColor = colorFromRGBA(255, 0, 0, 255);
+
+  auto paragraphShadowNode = cloneWithTextFragment({.props = textProps});
+
+  EXPECT_TRUE(paragraphShadowNode->getIsLayoutClean());
+
+  // The new content reaches the mounting layer through the state.
+  const auto* content = getContent(*paragraphShadowNode);
+  ASSERT_NE(content, nullptr);
+  EXPECT_NE(content, getContent(*paragraphShadowNode_));
+  const auto& attributedString =
+      paragraphShadowNode->getStateData().attributedString;
+  EXPECT_EQ(attributedString, content->attributedString);
+  ASSERT_EQ(attributedString.getFragments().size(), 1);
+  EXPECT_EQ(
+      attributedString.getFragments()[0].textAttributes.foregroundColor,
+      colorFromRGBA(255, 0, 0, 255));
+}
+
+TEST_F(ParagraphShadowNodeTest, layoutChangeDropsContent) {
+  auto rawTextProps = std::make_shared<RawTextProps>();
+  rawTextProps->text = "Hello, World";
+  auto rawTextShadowNode = rawTextShadowNode_->clone({.props = rawTextProps});
+
+  auto paragraphShadowNode = cloneWithTextFragment(
+      {.children = std::make_shared<const ShadowNode::ListOfShared>(
+           ShadowNode::ListOfShared{rawTextShadowNode})});
+
+  // The content is built again (with the new text) when the paragraph is
+  // measured.
+  EXPECT_FALSE(paragraphShadowNode->getIsLayoutClean());
+  EXPECT_EQ(getContent(*paragraphShadowNode), nullptr);
+}
+
+TEST_F(ParagraphShadowNodeTest, appendingChildrenDropsContent) {
+  // Clones the paragraph the way `cloneNodeWithNewChildren` does.
+  auto paragraphShadowNode = std::static_pointer_cast<ParagraphShadowNode>(
+      paragraphShadowNode_->clone(
+          {.children = ShadowNode::emptySharedShadowNodeSharedList()}));
+  paragraphShadowNode->appendChild(textShadowNode_);
+
+  EXPECT_FALSE(paragraphShadowNode->getIsLayoutClean());
+  EXPECT_EQ(getContent(*paragraphShadowNode), nullptr);
+
+  auto rootShadowNode = std::static_pointer_cast<RootShadowNode>(
+      rootShadowNode_->ShadowNode::clone(
+          {.children = std::make_shared<const ShadowNode::ListOfShared>(
+               ShadowNode::ListOfShared{paragraphShadowNode})}));
+  rootShadowNode->layoutIfNeeded();
+
+  const auto& layoutParagraphShadowNode =
+      static_cast<const ParagraphShadowNode&>(
+          *rootShadowNode->getChildren().front());
+  EXPECT_EQ(
+      layoutParagraphShadowNode.getStateData().attributedString.getString(),
+      "Hello");
+}
+
+} // namespace facebook::react
@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "ViewPropsMapBuffer.h"
+
+#include <cmath>
+#include <optional>
+#include <type_traits>
+
+#include <react/utils/to_underlying.h>
+
+namespace facebook::react {
+
+namespace {
+
+int32_t toARGB(const SharedColor& color) {
+  if (!color) {
+    return VP_UNDEFINED_COLOR;
+  }
+
+  auto components = colorComponentsFromColor(color);
+  auto channel = [](float value) {
+    return static_cast<uint32_t>(std::lround(value * 255.0f)) & 0xff;
+  };
+  return static_cast<int32_t>(
+      channel(components.alpha) << 24 | channel(components.red) << 16 |
+      channel(components.green) << 8 | channel(components.blue));
+}
+
+template <typename T>
+int32_t toInt(T value) {
+  return static_cast<int32_t>(to_underlying(value));
+}
+
+MapBuffer toMapBuffer(const ValueUnit& valueUnit) {
+  auto builder = MapBufferBuilder{2};
+  builder.putDouble(VP_VALUE_UNIT_VALUE, valueUnit.value);
+  builder.putInt(VP_VALUE_UNIT_UNIT, toInt(valueUnit.unit));
+  return builder.build();
+}
+
+void putValue(
+    MapBufferBuilder& builder,
+    MapBuffer::Key key,
+    const SharedColor& value) {
+  builder.putInt(key, toARGB(value));
+}
+
+void putValue(
+    MapBufferBuilder& builder,
+    MapBuffer::Key key,
+    const ValueUnit& value) {
+  builder.putMapBuffer(key, toMapBuffer(value));
+}
+
+template <typename T>
+  requires std::is_enum_v<T>
+void putValue(MapBufferBuilder& builder, MapBuffer::Key key, T value) {
+  builder.putInt(key, toInt(value));
+}
+
+template <typename T>
+void putOptionalValue(
+    MapBufferBuilder& builder,
+    MapBuffer::Key key,
+    const std::optional<T>& value) {
+  if (value.has_value()) {
+    putValue(builder, key, *value);
+  }
+}
+
+template <typename T>
+MapBuffer toMapBuffer(const CascadedRectangleEdges<T>& edges) {
+  auto builder = MapBufferBuilder{};
+  putOptionalValue(builder, VP_EDGE_LEFT, edges.left);
+  putOptionalValue(builder, VP_EDGE_TOP, edges.top);
+  putOptionalValue(builder, VP_EDGE_RIGHT, edges.right);
+  putOptionalValue(builder, VP_EDGE_BOTTOM, edges.bottom);
+  putOptionalValue(builder, VP_EDGE_START, edges.start);
+  putOptionalValue(builder, VP_EDGE_END, edges.end);
+  putOptionalValue(builder, VP_EDGE_HORIZONTAL, edges.horizontal);
+  putOptionalValue(builder, VP_EDGE_VERTICAL, edges.vertical);
+  putOptionalValue(builder, VP_EDGE_ALL, edges.all);
+  putOptionalValue(builder, VP_EDGE_BLOCK, edges.block);
+  putOptionalValue(builder, VP_EDGE_BLOCK_START, edges.blockStart);
+  putOptionalValue(builder, VP_EDGE_BLOCK_END, edges.blockEnd);
+  return builder.build();
+}
+
+template <typename T>
+MapBuffer toMapBuffer(const CascadedRectangleCorners<T>& corners) {
+  auto builder = MapBufferBuilder{};
+  putOptionalValue(builder, VP_CORNER_TOP_LEFT, corners.topLeft);
+  putOptionalValue(builder, VP_CORNER_TOP_RIGHT, corners.topRight);
+  putOptionalValue(builder, VP_CORNER_BOTTOM_LEFT, corners.bottomLeft);
+  putOptionalValue(builder, VP_CORNER_BOTTOM_RIGHT, corners.bottomRight);
+  putOptionalValue(builder, VP_CORNER_TOP_START, corners.topStart);
+  putOptionalValue(builder, VP_CORNER_TOP_END, corners.topEnd);
+  putOptionalValue(builder, VP_CORNER_BOTTOM_START, corners.bottomStart);
+  putOptionalValue(builder, VP_CORNER_BOTTOM_END, corners.bottomEnd);
+  putOptionalValue(builder, VP_CORNER_ALL, corners.all);
+  putOptionalValue(builder, VP_CORNER_END_END, corners.endEnd);
+  putOptionalValue(builder, VP_CORNER_END_START, corners.endStart);
+  putOptionalValue(builder, VP_CORNER_START_END, corners.startEnd);
+  putOptionalValue(builder, VP_CORNER_START_START, corners.startStart);
+  return builder.build();
+}
+
+MapBuffer toMapBuffer(const Transform& transform) {
+  auto builder = MapBufferBuilder{16};
+  for (size_t i = 0; i < transform.matrix.size(); i++) {
+    builder.putDouble(static_cast<MapBuffer::Key>(i), transform.matrix[i]);
+  }
+  return builder.build();
+}
+
+MapBuffer toMapBuffer(const TransformOrigin& transformOrigin) {
+  auto builder = MapBufferBuilder{3};
+  builder.putMapBuffer(
+      VP_TRANSFORM_ORIGIN_X, toMapBuffer(transformOrigin.xy[0]));
+  builder.putMapBuffer(
+      VP_TRANSFORM_ORIGIN_Y, toMapBuffer(transformOrigin.xy[1]));
+  builder.putDouble(VP_TRANSFORM_ORIGIN_Z, transformOrigin.z);
+  return builder.build();
+}
+
+MapBuffer toMapBuffer(const Size& size) {
+  auto builder = MapBufferBuilder{2};
+  builder.putDouble(VP_SIZE_WIDTH, size.width);
+  builder.putDouble(VP_SIZE_HEIGHT, size.height);
+  return builder.build();
+}
+
+MapBuffer toMapBuffer(const EdgeInsets& insets) {
+  auto builder = MapBufferBuilder{4};
+  builder.putDouble(VP_INSETS_LEFT, insets.left);
+  builder.putDouble(VP_INSETS_TOP, insets.top);
+  builder.putDouble(VP_INSETS_RIGHT, insets.right);
+  builder.putDouble(VP_INSETS_BOTTOM, insets.bottom);
+  return builder.build();
+}
+
+MapBuffer toMapBuffer(const std::optional<int>& value) {
+  auto builder = MapBufferBuilder{1};
+  if (value.has_value()) {
+    builder.putInt(VP_OPTIONAL_VALUE, *value);
+  }
+  return builder.build();
+}
+
+} // namespace
+
+void updateViewPropsMapBuffer(
+    const ViewProps& oldProps,
+    const ViewProps& newProps,
+    MapBufferBuilder& builder) {
+  // Keys are written in ascending order, so the builder never needs to sort.
+
+  if (oldProps.nativeId != newProps.nativeId) {
+    builder.putString(VP_NATIVE_ID, newProps.nativeId);
+  }
+
+  if (oldProps.accessible != newProps.accessible) {
+    builder.putBool(VP_ACCESSIBLE, newProps.accessible);
+  }
+
+  if (oldProps.accessibilityLabel != newProps.accessibilityLabel) {
+    builder.putString(VP_ACCESSIBILITY_LABEL, newProps.accessibilityLabel);
+  }
+
+  if (oldProps.accessibilityHint != newProps.accessibilityHint) {
+    builder.putString(VP_ACCESSIBILITY_HINT, newProps.accessibilityHint);
+  }
+
+  if (oldProps.accessibilityRole != newProps.accessibilityRole) {
+    builder.putString(VP_ACCESSIBILITY_ROLE, newProps.accessibilityRole);
+  }
+
+  if (oldProps.accessibilityLiveRegion != newProps.accessibilityLiveRegion) {
+    builder.putInt(
+        VP_ACCESSIBILITY_LIVE_REGION, toInt(newProps.accessibilityLiveRegion));
+  }
+
+  if (oldProps.importantForAccessibility !=
+      newProps.importantForAccessibility) {
+    builder.putInt(
+        VP_IMPORTANT_FOR_ACCESSIBILITY,
+        toInt(newProps.importantForAccessibility));
+  }
+
+  if (oldProps.role != newProps.role) {
+    builder.putInt(VP_ROLE, toInt(newProps.role));
+  }
+
+  if (oldProps.testId != newProps.testId) {
+    builder.putString(VP_TEST_ID, newProps.testId);
+  }
+
+  if (oldProps.opacity != newProps.opacity) {
+    builder.putDouble(VP_OPACITY, newProps.opacity);
+  }
+
+  if (oldProps.backgroundColor != newProps.backgroundColor) {
+    builder.putInt(VP_BACKGROUND_COLOR, toARGB(newProps.backgroundColor));
+  }
+
+  if (oldProps.borderRadii != newProps.borderRadii) {
+    builder.putMapBuffer(VP_BORDER_RADII, toMapBuffer(newProps.borderRadii));
+  }
+
+  if (oldProps.borderColors != newProps.borderColors) {
+    builder.putMapBuffer(VP_BORDER_COLORS, toMapBuffer(newProps.borderColors));
+  }
+
+  if (oldProps.borderStyles != newProps.borderStyles) {
+    builder.putMapBuffer(VP_BORDER_STYLES, toMapBuffer(newProps.borderStyles));
+  }
+
+  if (oldProps.outlineColor != newProps.outlineColor) {
+    builder.putInt(VP_OUTLINE_COLOR, toARGB(newProps.outlineColor));
+  }
+
+  if (oldProps.outlineOffset != newProps.outlineOffset) {
+    builder.putDouble(VP_OUTLINE_OFFSET, newProps.outlineOffset);
+  }
+
+  if (oldProps.outlineStyle != newProps.outlineStyle) {
+    builder.putInt(VP_OUTLINE_STYLE, toInt(newProps.outlineStyle));
+  }
+
+  if (oldProps.outlineWidth != newProps.outlineWidth) {
+    builder.putDouble(VP_OUTLINE_WIDTH, newProps.outlineWidth);
+  }
+
+  if (oldProps.shadowColor != newProps.shadowColor) {
+    builder.putInt(VP_SHADOW_COLOR, toARGB(newProps.shadowColor));
+  }
+
+  if (oldProps.shadowOffset != newProps.shadowOffset) {
+    builder.putMapBuffer(VP_SHADOW_OFFSET, toMapBuffer(newProps.shadowOffset));
+  }
+
+  if (oldProps.shadowOpacity != newProps.shadowOpacity) {
+    builder.putDouble(VP_SHADOW_OPACITY, newProps.shadowOpacity);
+  }
+
+  if (oldProps.shadowRadius != newProps.shadowRadius) {
+    builder.putDouble(VP_SHADOW_RADIUS, newProps.shadowRadius);
+  }
+
+  if (oldProps.cursor != newProps.cursor) {
+    builder.putInt(VP_CURSOR, toInt(newProps.cursor));
+  }
+
+  if (oldProps.mixBlendMode != newProps.mixBlendMode) {
+    builder.putInt(VP_MIX_BLEND_MODE, toInt(newProps.mixBlendMode));
+  }
+
+  if (oldProps.isolation != newProps.isolation) {
+    builder.putInt(VP_ISOLATION, toInt(newProps.isolation));
+  }
+
+  if (oldProps.transform != newProps.transform) {
+    builder.putMapBuffer(VP_TRANSFORM, toMapBuffer(newProps.transform));
+  }
+
+  if (oldProps.transformOrigin != newProps.transformOrigin) {
+    builder.putMapBuffer(
+        VP_TRANSFORM_ORIGIN, toMapBuffer(newProps.transformOrigin));
+  }
+
+  if (oldProps.backfaceVisibility != newProps.backfaceVisibility) {
+    builder.putInt(VP_BACKFACE_VISIBILITY, toInt(newProps.backfaceVisibility));
+  }
+
+  if (oldProps.shouldRasterize != newProps.shouldRasterize) {
+    builder.putBool(VP_SHOULD_RASTERIZE, newProps.shouldRasterize);
+  }
+
+  if (oldProps.zIndex != newProps.zIndex) {
+    builder.putMapBuffer(VP_Z_INDEX, toMapBuffer(newProps.zIndex));
+  }
+
+  if (oldProps.pointerEvents != newProps.pointerEvents) {
+    builder.putInt(VP_POINTER_EVENTS, toInt(newProps.pointerEvents));
+  }
+
+  if (oldProps.hitSlop != newProps.hitSlop) {
+    builder.putMapBuffer(VP_HIT_SLOP, toMapBuffer(newProps.hitSlop));
+  }
+
+  if (oldProps.collapsable != newProps.collapsable) {
+    builder.putBool(VP_COLLAPSABLE, newProps.collapsable);
+  }
+
+  if (oldProps.removeClippedSubviews != newProps.removeClippedSubviews) {
+    builder.putBool(
+        VP_REMOVE_CLIPPED_SUBVIEWS, newProps.removeClippedSubviews);
+  }
+}
+
+MapBuffer viewPropsDiff(const ViewProps& oldProps, const ViewProps& newProps) {
+  auto builder = MapBufferBuilder{};
+  updateViewPropsMapBuffer(oldProps, newProps, builder);
+  return builder.build();
+}
+
+} // namespace facebook::react
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+#include <react/renderer/components/view/ViewProps.h>
+#include <react/renderer/mapbuffer/MapBuffer.h>
+#include <react/renderer/mapbuffer/MapBufferBuilder.h>
+
+namespace facebook::react {
+
+/*
+ * Keys of `ViewProps` fields in MapBuffers produced by `viewPropsDiff`.
+ * The keys are shared with the consumers of the diff: never reuse or
+ * renumber them, only append new ones.
+ */
+
+// Props
+constexpr MapBuffer::Key VP_NATIVE_ID = 0;
+
+// AccessibilityProps
+constexpr MapBuffer::Key VP_ACCESSIBLE = 1;
+constexpr MapBuffer::Key VP_ACCESSIBILITY_LABEL = 2;
+constexpr MapBuffer::Key VP_ACCESSIBILITY_HINT = 3;
+constexpr MapBuffer::Key VP_ACCESSIBILITY_ROLE = 4;
+constexpr MapBuffer::Key VP_ACCESSIBILITY_LIVE_REGION = 5;
+constexpr MapBuffer::Key VP_IMPORTANT_FOR_ACCESSIBILITY = 6;
+constexpr MapBuffer::Key VP_ROLE = 7;
+constexpr MapBuffer::Key VP_TEST_ID = 8;
+
+// BaseViewProps
+constexpr MapBuffer::Key VP_OPACITY = 9;
+constexpr MapBuffer::Key VP_BACKGROUND_COLOR = 10;
+constexpr MapBuffer::Key VP_BORDER_RADII = 11;
+constexpr MapBuffer::Key VP_BORDER_COLORS = 12;
+constexpr MapBuffer::Key VP_BORDER_STYLES = 13;
+constexpr MapBuffer::Key VP_OUTLINE_COLOR = 14;
+constexpr MapBuffer::Key VP_OUTLINE_OFFSET = 15;
+constexpr MapBuffer::Key VP_OUTLINE_STYLE = 16;
+constexpr MapBuffer::Key VP_OUTLINE_WIDTH = 17;
+constexpr MapBuffer::Key VP_SHADOW_COLOR = 18;
+constexpr MapBuffer::Key VP_SHADOW_OFFSET = 19;
+constexpr MapBuffer::Key VP_SHADOW_OPACITY = 20;
+constexpr MapBuffer::Key VP_SHADOW_RADIUS = 21;
+constexpr MapBuffer::Key VP_CURSOR = 22;
+constexpr MapBuffer::Key VP_MIX_BLEND_MODE = 23;
+constexpr MapBuffer::Key VP_ISOLATION = 24;
+constexpr MapBuffer::Key VP_TRANSFORM = 25;
+constexpr MapBuffer::Key VP_TRANSFORM_ORIGIN = 26;
+constexpr MapBuffer::Key VP_BACKFACE_VISIBILITY = 27;
+constexpr MapBuffer::Key VP_SHOULD_RASTERIZE = 28;
+constexpr MapBuffer::Key VP_Z_INDEX = 29;
+constexpr MapBuffer::Key VP_POINTER_EVENTS = 30;
+constexpr MapBuffer::Key VP_HIT_SLOP = 31;
+constexpr MapBuffer::Key VP_COLLAPSABLE = 32;
+constexpr MapBuffer::Key VP_REMOVE_CLIPPED_SUBVIEWS = 33;
+
+/*
+ * Keys of nested MapBuffers.
+ * Cascaded edges (`VP_BORDER_COLORS`, `VP_BORDER_STYLES`) and corners
+ * (`VP_BORDER_RADII`) are keyed by the declaration order of the fields of
+ * `CascadedRectangleEdges` and `CascadedRectangleCorners`; unset fields are
+ * omitted. The whole nested map is sent whenever any of its fields changes.
+ */
+constexpr MapBuffer::Key VP_EDGE_LEFT = 0;
+constexpr MapBuffer::Key VP_EDGE_TOP = 1;
+constexpr MapBuffer::Key VP_EDGE_RIGHT = 2;
+constexpr MapBuffer::Key VP_EDGE_BOTTOM = 3;
+constexpr MapBuffer::Key VP_EDGE_START = 4;
+constexpr MapBuffer::Key VP_EDGE_END = 5;
+constexpr MapBuffer::Key VP_EDGE_HORIZONTAL = 6;
+constexpr MapBuffer::Key VP_EDGE_VERTICAL = 7;
+constexpr MapBuffer::Key VP_EDGE_ALL = 8;
+constexpr MapBuffer::Key VP_EDGE_BLOCK = 9;
+constexpr MapBuffer::Key VP_EDGE_BLOCK_START = 10;
+constexpr MapBuffer::Key VP_EDGE_BLOCK_END = 11;
+
+constexpr MapBuffer::Key VP_CORNER_TOP_LEFT = 0;
+constexpr MapBuffer::Key VP_CORNER_TOP_RIGHT = 1;
+constexpr MapBuffer::Key VP_CORNER_BOTTOM_LEFT = 2;
+constexpr MapBuffer::Key VP_CORNER_BOTTOM_RIGHT = 3;
+constexpr MapBuffer::Key VP_CORNER_TOP_START = 4;
+constexpr MapBuffer::Key VP_CORNER_TOP_END = 5;
+constexpr MapBuffer::Key VP_CORNER_BOTTOM_START = 6;
+constexpr MapBuffer::Key VP_CORNER_BOTTOM_END = 7;
+constexpr MapBuffer::Key VP_CORNER_ALL = 8;
+constexpr MapBuffer::Key VP_CORNER_END_END = 9;
+constexpr MapBuffer::Key VP_CORNER_END_START = 10;
+constexpr MapBuffer::Key VP_CORNER_START_END = 11;
+constexpr MapBuffer::Key VP_CORNER_START_START = 12;
+
+// `ValueUnit`s (border radii, transform origin).
+constexpr MapBuffer::Key VP_VALUE_UNIT_VALUE = 0;
+constexpr MapBuffer::Key VP_VALUE_UNIT_UNIT = 1;
+
+// `VP_TRANSFORM` stores the 16 matrix elements under keys 0...15.
+// `VP_TRANSFORM_ORIGIN` stores `ValueUnit`s for x and y and a double for z.
+constexpr MapBuffer::Key VP_TRANSFORM_ORIGIN_X = 0;
+constexpr MapBuffer::Key VP_TRANSFORM_ORIGIN_Y = 1;
+constexpr MapBuffer::Key VP_TRANSFORM_ORIGIN_Z = 2;
+
+// `VP_SHADOW_OFFSET`
+constexpr MapBuffer::Key VP_SIZE_WIDTH = 0;
+constexpr MapBuffer::Key VP_SIZE_HEIGHT = 1;
+
+// `VP_HIT_SLOP`
+constexpr MapBuffer::Key VP_INSETS_LEFT = 0;
+constexpr MapBuffer::Key VP_INSETS_TOP = 1;
+constexpr MapBuffer::Key VP_INSETS_RIGHT = 2;
+constexpr MapBuffer::Key VP_INSETS_BOTTOM = 3;
+
+// `VP_Z_INDEX` is a nested map which is empty if `zIndex` is unset.
+constexpr MapBuffer::Key VP_OPTIONAL_VALUE = 0;
+
+/*
+ * Colors are encoded as ARGB integers; this value represents an undefined
+ * (unset) color.
+ */
+constexpr int32_t VP_UNDEFINED_COLOR = std::numeric_limits<int32_t>::max();
+
+/*
+ * Writes the fields of `newProps` which differ from `oldProps` into
+ * `builder`. Enums are encoded as their underlying integer values.
+ * Components with props derived from `ViewProps` can call this first and
+ * then append their own fields (with keys which don't clash with the ones
+ * above).
+ */
+void updateViewPropsMapBuffer(
+    const ViewProps& oldProps,
+    const ViewProps& newProps,
+    MapBufferBuilder& builder);
+
+/*
+ * Returns a MapBuffer with the fields of `newProps` which differ from
+ * `oldProps`. Diffing against default-constructed props yields every field
+ * which differs from its default value.
+ */
+MapBuffer viewPropsDiff(const ViewProps& oldProps, const ViewProps& newProps);
+
+} // namespace facebook::react
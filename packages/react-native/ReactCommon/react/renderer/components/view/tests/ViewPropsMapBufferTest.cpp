@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/view/ViewPropsMapBuffer.h>
+
+namespace facebook::react {
+
+TEST(ViewPropsMapBufferTest, equalPropsProduceEmptyDiff) {
+  auto oldProps = ViewProps{};
+  auto newProps = ViewProps{};
+
+  EXPECT_EQ(viewPropsDiff(oldProps, newProps).count(), 0);
+}
+
+TEST(ViewPropsMapBufferTest, onlyChangedFieldsAreEncoded) {
+  auto oldProps = ViewProps{};
+  auto newProps = ViewProps{};
+  newProps.opacity = 0.5;
+  newProps.backgroundColor = colorFromRGBA(255, 0, 0, 255);
+  newProps.testId = "row";
+  newProps.pointerEvents = PointerEventsMode::BoxNone;
+
+  auto diff = viewPropsDiff(oldProps, newProps);
+
+  EXPECT_EQ(diff.count(), 4);
+  EXPECT_EQ(diff.getDouble(VP_OPACITY), 0.5);
+  EXPECT_EQ(
+      static_cast<uint32_t>(diff.getInt(VP_BACKGROUND_COLOR)), 0xffff0000);
+  EXPECT_EQ(diff.getString(VP_TEST_ID), "row");
+  EXPECT_EQ(
+      diff.getInt(VP_POINTER_EVENTS),
+      static_cast<int32_t>(PointerEventsMode::BoxNone));
+}
+
+TEST(ViewPropsMapBufferTest, resettingFieldsEncodesDefaults) {
+  auto oldProps = ViewProps{};
+  oldProps.backgroundColor = colorFromRGBA(0, 0, 255, 255);
+  oldProps.zIndex = 3;
+  auto newProps = ViewProps{};
+
+  auto diff = viewPropsDiff(oldProps, newProps);
+
+  EXPECT_EQ(diff.count(), 2);
+  EXPECT_EQ(diff.getInt(VP_BACKGROUND_COLOR), VP_UNDEFINED_COLOR);
+  EXPECT_EQ(diff.getMapBuffer(VP_Z_INDEX).count(), 0);
+
+  auto reverseDiff = viewPropsDiff(newProps, oldProps);
+  EXPECT_EQ(reverseDiff.getMapBuffer(VP_Z_INDEX).getInt(VP_OPTIONAL_VALUE), 3);
+}
+
+TEST(ViewPropsMapBufferTest, cascadedValuesAreEncodedAsNestedMaps) {
+  auto oldProps = ViewProps{};
+  auto newProps = ViewProps{};
+  newProps.borderRadii.topLeft = ValueUnit{4, UnitType::Point};
+  newProps.borderRadii.all = ValueUnit{50, UnitType::Percent};
+  newProps.borderColors.all = colorFromRGBA(0, 0, 255, 128);
+  newProps.borderStyles.bottom = BorderStyle::Dashed;
+
+  auto diff = viewPropsDiff(oldProps, newProps);
+  EXPECT_EQ(diff.count(), 3);
+
+  auto borderRadii = diff.getMapBuffer(VP_BORDER_RADII);
+  EXPECT_EQ(borderRadii.count(), 2);
+  auto topLeft = borderRadii.getMapBuffer(VP_CORNER_TOP_LEFT);
+  EXPECT_EQ(topLeft.getDouble(VP_VALUE_UNIT_VALUE), 4);
+  EXPECT_EQ(
+      topLeft.getInt(VP_VALUE_UNIT_UNIT),
+      static_cast<int32_t>(UnitType::Point));
+  auto all = borderRadii.getMapBuffer(VP_CORNER_ALL);
+  EXPECT_EQ(all.getDouble(VP_VALUE_UNIT_VALUE), 50);
+  EXPECT_EQ(
+      all.getInt(VP_VALUE_UNIT_UNIT), static_cast<int32_t>(UnitType::Percent));
+
+  auto borderColors = diff.getMapBuffer(VP_BORDER_COLORS);
+  EXPECT_EQ(borderColors.count(), 1);
+  EXPECT_EQ(
+      static_cast<uint32_t>(borderColors.getInt(VP_EDGE_ALL)), 0x800000ff);
+
+  auto borderStyles = diff.getMapBuffer(VP_BORDER_STYLES);
+  EXPECT_EQ(borderStyles.count(), 1);
+  EXPECT_EQ(
+      borderStyles.getInt(VP_EDGE_BOTTOM),
+      static_cast<int32_t>(BorderStyle::Dashed));
+}
+
+TEST(ViewPropsMapBufferTest, transformIsEncodedAsMatrix) {
+  auto oldProps = ViewProps{};
+  auto newProps = ViewProps{};
+  newProps.transform = Transform::Scale(2, 3, 1);
+
+  auto diff = viewPropsDiff(oldProps, newProps);
+  EXPECT_EQ(diff.count(), 1);
+
+  auto matrix = diff.getMapBuffer(VP_TRANSFORM);
+  EXPECT_EQ(matrix.count(), 16);
+  for (MapBuffer::Key i = 0; i < 16; i++) {
+    EXPECT_EQ(matrix.getDouble(i), newProps.transform.matrix[i]);
+  }
+}
+
+} // namespace facebook::react
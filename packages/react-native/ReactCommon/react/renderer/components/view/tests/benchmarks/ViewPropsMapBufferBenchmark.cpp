@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/components/view/ViewPropsMapBuffer.h>
+#include <memory>
+
+namespace facebook::react {
+
+namespace {
+
+// A typical styled row: most fields differ from the defaults.
+std::shared_ptr<ViewProps> makeStyledProps() {
+  auto props = std::make_shared<ViewProps>();
+  props->opacity = 0.9;
+  props->backgroundColor = colorFromRGBA(255, 255, 255, 255);
+  props->borderRadii.all = ValueUnit{12, UnitType::Point};
+  props->borderColors.bottom = colorFromRGBA(0, 0, 0, 32);
+  props->shadowColor = colorFromRGBA(0, 0, 0, 255);
+  props->shadowOpacity = 0.2;
+  props->transform =
+      Transform::Translate(10, 0, 0) * Transform::Scale(1.5, 1.5, 1);
+  props->testId = "ConversationRow";
+  props->nativeId = "conversation-row";
+  props->accessible = true;
+  props->accessibilityLabel = "Open conversation";
+  props->pointerEvents = PointerEventsMode::BoxNone;
+  props->hitSlop = {8, 8, 8, 8};
+  return props;
+}
+
+auto defaultProps = std::make_shared<const ViewProps>();
+auto styledProps = makeStyledProps();
+
+// The same row after an animation frame: only opacity changed.
+std::shared_ptr<ViewProps> makeUpdatedProps() {
+  auto props = makeStyledProps();
+  props->opacity = 0.8;
+  return props;
+}
+
+auto updatedProps = makeUpdatedProps();
+
+} // namespace
+
+static void viewPropsDiffOfMount(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(viewPropsDiff(*defaultProps, *styledProps));
+  }
+}
+BENCHMARK(viewPropsDiffOfMount);
+
+static void viewPropsDiffOfSingleFieldUpdate(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(viewPropsDiff(*styledProps, *updatedProps));
+  }
+}
+BENCHMARK(viewPropsDiffOfSingleFieldUpdate);
+
+static void viewPropsDiffOfEqualProps(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(viewPropsDiff(*styledProps, *styledProps));
+  }
+}
+BENCHMARK(viewPropsDiffOfEqualProps);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
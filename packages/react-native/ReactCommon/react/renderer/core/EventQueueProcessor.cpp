@@ -19,10 +19,12 @@ EventQueueProcessor::EventQueueProcessor(
     EventPipe eventPipe,
     EventPipeConclusion eventPipeConclusion,
     StatePipe statePipe,
+    StateBatchPipe stateBatchPipe,
     std::weak_ptr<EventLogger> eventLogger)
     : eventPipe_(std::move(eventPipe)),
       eventPipeConclusion_(std::move(eventPipeConclusion)),
       statePipe_(std::move(statePipe)),
+      stateBatchPipe_(std::move(stateBatchPipe)),
       eventLogger_(std::move(eventLogger)) {}
 
 void EventQueueProcessor::flushEvents(
@@ -121,6 +123,13 @@ void EventQueueProcessor::flushEvents(
 
 void EventQueueProcessor::flushStateUpdates(
     std::vector<StateUpdate>&& states) const {
+  if (stateBatchPipe_ && states.size() > 1) {
+    // Apply all pending updates at once instead of running a full commit
+    // for each of them.
+    stateBatchPipe_(std::move(states));
+    return;
+  }
+
   for (const auto& stateUpdate : states) {
     statePipe_(stateUpdate);
   }
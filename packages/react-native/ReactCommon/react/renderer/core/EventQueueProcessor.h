@@ -23,6 +23,7 @@ class EventQueueProcessor {
       EventPipe eventPipe,
       EventPipeConclusion eventPipeConclusion,
       StatePipe statePipe,
+      StateBatchPipe stateBatchPipe,
       std::weak_ptr<EventLogger> eventLogger);
 
   void flushEvents(jsi::Runtime& runtime, std::vector<RawEvent>&& events) const;
@@ -32,6 +33,7 @@ class EventQueueProcessor {
   const EventPipe eventPipe_;
   const EventPipeConclusion eventPipeConclusion_;
   const StatePipe statePipe_;
+  const StateBatchPipe stateBatchPipe_;
   const std::weak_ptr<EventLogger> eventLogger_;
 
   mutable bool hasContinuousEventStarted_{false};
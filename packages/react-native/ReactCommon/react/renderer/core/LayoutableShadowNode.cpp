@@ -10,6 +10,7 @@
 #include <react/renderer/core/LayoutConstraints.h>
 #include <react/renderer/core/LayoutContext.h>
 #include <react/renderer/core/LayoutMetrics.h>
+#include <react/renderer/core/RelativeLayoutMetricsCache.h>
 #include <react/renderer/core/ShadowNode.h>
 #include <react/renderer/core/graphicsConversions.h>
 #include <react/renderer/debug/DebugStringConvertibleItem.h>
@@ -32,33 +33,11 @@ LayoutableShadowNode::LayoutableShadowNode(
       layoutMetrics_(static_cast<const LayoutableShadowNode&>(sourceShadowNode)
                          .layoutMetrics_) {}
 
-LayoutMetrics LayoutableShadowNode::computeRelativeLayoutMetrics(
-    const ShadowNodeFamily& descendantNodeFamily,
-    const LayoutableShadowNode& ancestorNode,
-    LayoutInspectingPolicy policy) {
-  // Prelude.
-
-  if (&descendantNodeFamily == &ancestorNode.getFamily()) {
-    // Layout metrics of a node computed relatively to the same node are equal
-    // to `transform`-ed layout metrics of the node with zero `origin`.
-    auto layoutMetrics = ancestorNode.getLayoutMetrics();
-    if (layoutMetrics.displayType == DisplayType::None) {
-      return EmptyLayoutMetrics;
-    }
-    if (policy.includeTransform) {
-      layoutMetrics.frame = layoutMetrics.frame * ancestorNode.getTransform();
-    }
-    layoutMetrics.frame.origin = {0, 0};
-    return layoutMetrics;
-  }
+namespace {
 
-  auto ancestors = descendantNodeFamily.getAncestors(ancestorNode);
-  return computeRelativeLayoutMetrics(ancestors, policy);
-}
-
-LayoutMetrics LayoutableShadowNode::computeRelativeLayoutMetrics(
-    const AncestorList& ancestors,
-    LayoutInspectingPolicy policy) {
+LayoutMetrics computeRelativeLayoutMetricsUncached(
+    const ShadowNode::AncestorList& ancestors,
+    LayoutableShadowNode::LayoutInspectingPolicy policy) {
   if (ancestors.empty()) {
     // Specified nodes do not form an ancestor-descender relationship
     // in the same tree. Aborting.
@@ -174,6 +153,79 @@ LayoutMetrics LayoutableShadowNode::computeRelativeLayoutMetrics(
   return layoutMetrics;
 }
 
+} // namespace
+
+LayoutMetrics LayoutableShadowNode::computeRelativeLayoutMetrics(
+    const ShadowNodeFamily& descendantNodeFamily,
+    const LayoutableShadowNode& ancestorNode,
+    LayoutInspectingPolicy policy) {
+  // Prelude.
+
+  if (&descendantNodeFamily == &ancestorNode.getFamily()) {
+    // Layout metrics of a node computed relatively to the same node are equal
+    // to `transform`-ed layout metrics of the node with zero `origin`.
+    auto layoutMetrics = ancestorNode.getLayoutMetrics();
+    if (layoutMetrics.displayType == DisplayType::None) {
+      return EmptyLayoutMetrics;
+    }
+    if (policy.includeTransform) {
+      layoutMetrics.frame = layoutMetrics.frame * ancestorNode.getTransform();
+    }
+    layoutMetrics.frame.origin = {0, 0};
+    return layoutMetrics;
+  }
+
+  // Layout of committed revisions never changes, so we can skip the ancestor
+  // walk entirely if the result was already computed for this revision.
+  auto cache = ancestorNode.getRelativeLayoutMetricsCache();
+  if (cache != nullptr) {
+    if (auto layoutMetrics = cache->get(descendantNodeFamily, policy)) {
+      return *layoutMetrics;
+    }
+  }
+
+  auto ancestors = descendantNodeFamily.getAncestors(ancestorNode);
+  auto layoutMetrics = computeRelativeLayoutMetricsUncached(ancestors, policy);
+
+  if (cache != nullptr) {
+    cache->set(descendantNodeFamily, policy, layoutMetrics);
+  }
+
+  return layoutMetrics;
+}
+
+LayoutMetrics LayoutableShadowNode::computeRelativeLayoutMetrics(
+    const AncestorList& ancestors,
+    LayoutInspectingPolicy policy) {
+  if (ancestors.empty()) {
+    // Specified nodes do not form an ancestor-descender relationship
+    // in the same tree. Aborting.
+    return EmptyLayoutMetrics;
+  }
+
+  auto ancestorNode = dynamic_cast<const LayoutableShadowNode*>(
+      &ancestors.front().first.get());
+  auto cache = ancestorNode != nullptr
+      ? ancestorNode->getRelativeLayoutMetricsCache()
+      : nullptr;
+
+  if (cache == nullptr) {
+    return computeRelativeLayoutMetricsUncached(ancestors, policy);
+  }
+
+  auto& pair = ancestors.at(ancestors.size() - 1);
+  auto& descendantNodeFamily =
+      pair.first.get().getChildren().at(pair.second)->getFamily();
+
+  if (auto layoutMetrics = cache->get(descendantNodeFamily, policy)) {
+    return *layoutMetrics;
+  }
+
+  auto layoutMetrics = computeRelativeLayoutMetricsUncached(ancestors, policy);
+  cache->set(descendantNodeFamily, policy, layoutMetrics);
+  return layoutMetrics;
+}
+
 LayoutMetrics LayoutableShadowNode::getLayoutMetrics() const {
   return layoutMetrics_;
 }
@@ -197,6 +249,11 @@ Point LayoutableShadowNode::getContentOriginOffset(
   return {0, 0};
 }
 
+RelativeLayoutMetricsCache*
+LayoutableShadowNode::getRelativeLayoutMetricsCache() const {
+  return nullptr;
+}
+
 bool LayoutableShadowNode::canBeTouchTarget() const {
   return false;
 }
@@ -23,6 +23,7 @@ namespace facebook::react {
 
 struct LayoutConstraints;
 struct LayoutContext;
+class RelativeLayoutMetricsCache;
 
 /*
  * Describes all sufficient layout API (in approach-agnostic way)
@@ -128,6 +129,15 @@ class LayoutableShadowNode : public ShadowNode {
    */
   virtual Point getContentOriginOffset(bool includeTransform) const;
 
+  /*
+   * Returns a cache of layout metrics of descendant nodes computed relatively
+   * to this node which `computeRelativeLayoutMetrics` may use, or `nullptr`.
+   * Only nodes whose layout is known to be final (e.g. the root node of a
+   * committed revision) might provide one.
+   * Default implementation returns `nullptr`.
+   */
+  virtual RelativeLayoutMetricsCache* getRelativeLayoutMetricsCache() const;
+
   /*
    * Sets layout metrics for the shadow node.
    */
@@ -20,7 +20,9 @@ namespace facebook::react {
 const RawValue* RawPropsParser::at(
     const RawProps& rawProps,
     const RawPropsKey& key) const noexcept {
-  if (!ready_) [[unlikely]] {
+  // Keys are only discovered during `ensurePrepared` (on the same thread);
+  // `preparse` has already synchronized with it otherwise.
+  if (!ready_.load(std::memory_order_relaxed)) [[unlikely]] {
     // Check against the same key being inserted more than once.
     // This happens commonly with nested Props structs, where the higher-level
     // struct may access all fields, and then the nested Props struct may
@@ -37,8 +39,8 @@ const RawValue* RawPropsParser::at(
         return nullptr;
       }
     }
-    // This is not thread-safe part; this happens only during initialization of
-    // a `ComponentDescriptor` where it is actually safe.
+    // This is not thread-safe part; this happens only during
+    // `ensurePrepared` which holds `mutex_`.
     keys_.push_back(key);
     react_native_assert(size < std::numeric_limits<RawPropsValueIndex>::max());
     nameToIndex_.insert(key, static_cast<RawPropsValueIndex>(size));
@@ -88,12 +90,30 @@ const RawValue* RawPropsParser::at(
                                                 : &rawProps.values_[valueIndex];
 }
 
-void RawPropsParser::postPrepare() noexcept {
-  ready_ = true;
+void RawPropsParser::ensurePrepared() const noexcept {
+  if (ready_.load(std::memory_order_acquire)) [[likely]] {
+    return;
+  }
+
+  if (discoverKeys_ == nullptr) {
+    // Not prepared for any particular type of Props.
+    return;
+  }
+
+  std::lock_guard lock(mutex_);
+  if (ready_.load(std::memory_order_relaxed)) {
+    // Prepared by another thread in the meantime.
+    return;
+  }
+
+  discoverKeys_(*this);
   nameToIndex_.reindex();
+  ready_.store(true, std::memory_order_release);
 }
 
 void RawPropsParser::preparse(const RawProps& rawProps) const noexcept {
+  ensurePrepared();
+
   const size_t keyCount = keys_.size();
   rawProps.keyIndexToValueIndex_.resize(keyCount, kRawPropsValueIndexEmpty);
 
@@ -7,6 +7,9 @@
 
 #pragma once
 
+#include <atomic>
+#include <mutex>
+
 #include <react/renderer/core/Props.h>
 #include <react/renderer/core/PropsParserContext.h>
 #include <react/renderer/core/RawProps.h>
@@ -31,12 +34,27 @@ class RawPropsParser final {
 
   /*
    * To be used by `ConcreteComponentDescriptor` only.
+   * The parser learns which keys `PropsT` reads (and in which order) by
+   * constructing it from empty `RawProps`. This is deferred until the parser
+   * is used for the first time: most of the registered components are never
+   * rendered, so the application doesn't have to pay for them at startup.
    */
   template <typename PropsT>
   void prepare() noexcept {
     static_assert(
         std::is_base_of<Props, PropsT>::value,
         "PropsT must be a descendant of Props");
+    discoverKeys_ = &discoverKeys<PropsT>;
+  }
+
+ private:
+  friend class ComponentDescriptor;
+  template <class ShadowNodeT>
+  friend class ConcreteComponentDescriptor;
+  friend class RawProps;
+
+  template <typename PropsT>
+  static void discoverKeys(const RawPropsParser& parser) noexcept {
     RawProps emptyRawProps{};
 
     // Create a stub parser context.
@@ -46,26 +64,21 @@ class RawPropsParser final {
     ContextContainer contextContainer{};
     PropsParserContext parserContext{-1, contextContainer};
 
-    emptyRawProps.parse(*this);
+    // Bypassing `RawProps::parse` (which would wait for the preparation
+    // to finish).
+    emptyRawProps.parser_ = &parser;
     PropsT(parserContext, {}, emptyRawProps);
-    postPrepare();
   }
 
- private:
-  friend class ComponentDescriptor;
-  template <class ShadowNodeT>
-  friend class ConcreteComponentDescriptor;
-  friend class RawProps;
-
   /*
-   * To be used by `RawProps` only.
+   * Prepares the parser unless it's already prepared. Thread safe.
    */
-  void preparse(const RawProps& rawProps) const noexcept;
+  void ensurePrepared() const noexcept;
 
   /*
-   * Non-generic part of `prepare`.
+   * To be used by `RawProps` only.
    */
-  void postPrepare() noexcept;
+  void preparse(const RawProps& rawProps) const noexcept;
 
   /*
    * To be used by `RawProps` only.
@@ -75,7 +88,9 @@ class RawPropsParser final {
 
   mutable std::vector<RawPropsKey> keys_{};
   mutable RawPropsKeyMap nameToIndex_{};
-  mutable bool ready_{false};
+  void (*discoverKeys_)(const RawPropsParser& parser) noexcept {nullptr};
+  mutable std::atomic<bool> ready_{false};
+  mutable std::mutex mutex_;
 };
 
 } // namespace facebook::react
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "RelativeLayoutMetricsCache.h"
+
+#include <react/utils/hash_combine.h>
+
+namespace facebook::react {
+
+void RelativeLayoutMetricsCache::enable() {
+  enabled_.store(true, std::memory_order_release);
+}
+
+bool RelativeLayoutMetricsCache::isEnabled() const {
+  return enabled_.load(std::memory_order_acquire);
+}
+
+std::optional<LayoutMetrics> RelativeLayoutMetricsCache::get(
+    const ShadowNodeFamily& family,
+    LayoutInspectingPolicy policy) {
+  if (!isEnabled()) {
+    return std::nullopt;
+  }
+
+  std::scoped_lock lock(mutex_);
+  auto iterator = entries_.find(makeKey(family, policy));
+  if (iterator == entries_.end()) {
+    numberOfMisses_++;
+    return std::nullopt;
+  }
+
+  numberOfHits_++;
+  return iterator->second;
+}
+
+void RelativeLayoutMetricsCache::set(
+    const ShadowNodeFamily& family,
+    LayoutInspectingPolicy policy,
+    const LayoutMetrics& layoutMetrics) {
+  if (!isEnabled()) {
+    return;
+  }
+
+  std::scoped_lock lock(mutex_);
+  entries_.insert_or_assign(makeKey(family, policy), layoutMetrics);
+}
+
+int RelativeLayoutMetricsCache::getNumberOfHits() const {
+  std::scoped_lock lock(mutex_);
+  return numberOfHits_;
+}
+
+int RelativeLayoutMetricsCache::getNumberOfMisses() const {
+  std::scoped_lock lock(mutex_);
+  return numberOfMisses_;
+}
+
+size_t RelativeLayoutMetricsCache::KeyHash::operator()(const Key& key) const {
+  return hash_combine(key.family, key.policy);
+}
+
+RelativeLayoutMetricsCache::Key RelativeLayoutMetricsCache::makeKey(
+    const ShadowNodeFamily& family,
+    LayoutInspectingPolicy policy) {
+  return Key{
+      .family = &family,
+      .policy = static_cast<uint8_t>(
+          (policy.includeTransform ? 1 : 0) |
+          (policy.includeViewportOffset ? 2 : 0) |
+          (policy.enableOverflowClipping ? 4 : 0))};
+}
+
+} // namespace facebook::react
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+#include <react/renderer/core/LayoutableShadowNode.h>
+
+namespace facebook::react {
+
+/*
+ * Memoizes layout metrics of nodes computed relatively to the node which owns
+ * the cache (a root node of a committed revision), keyed by node family and
+ * inspecting policy. Layout of a committed revision never changes, so the
+ * cache is filled lazily and shared by all consumers of the revision
+ * (`measure`, `getBoundingClientRect`, intersection observers and so on)
+ * until the next commit replaces the revision altogether.
+ *
+ * The cache is disabled until `enable()` is called; the owner must only do
+ * that once the layout of the tree is final.
+ * The class is thread-safe.
+ */
+class RelativeLayoutMetricsCache final {
+ public:
+  using LayoutInspectingPolicy = LayoutableShadowNode::LayoutInspectingPolicy;
+
+  /*
+   * Starts serving and filling the cache. Irreversible.
+   */
+  void enable();
+
+  /*
+   * Returns `true` if the cache is enabled.
+   */
+  bool isEnabled() const;
+
+  /*
+   * Returns memoized layout metrics for given `family` and `policy`
+   * (or `std::nullopt`) and bumps the hit or miss counter accordingly.
+   * Always returns `std::nullopt` (without counting) if the cache is disabled.
+   */
+  std::optional<LayoutMetrics> get(
+      const ShadowNodeFamily& family,
+      LayoutInspectingPolicy policy);
+
+  /*
+   * Memoizes `layoutMetrics` for given `family` and `policy`.
+   * Does nothing if the cache is disabled.
+   */
+  void set(
+      const ShadowNodeFamily& family,
+      LayoutInspectingPolicy policy,
+      const LayoutMetrics& layoutMetrics);
+
+  /*
+   * Returns the number of lookups which were served from the cache and the
+   * number of lookups which were not.
+   */
+  int getNumberOfHits() const;
+  int getNumberOfMisses() const;
+
+ private:
+  struct Key {
+    const ShadowNodeFamily* family;
+    uint8_t policy;
+
+    bool operator==(const Key& rhs) const = default;
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const;
+  };
+
+  static Key makeKey(
+      const ShadowNodeFamily& family,
+      LayoutInspectingPolicy policy);
+
+  std::atomic<bool> enabled_{false};
+  mutable std::mutex mutex_;
+  std::unordered_map<Key, LayoutMetrics, KeyHash> entries_;
+  int numberOfHits_{0};
+  int numberOfMisses_{0};
+};
+
+} // namespace facebook::react
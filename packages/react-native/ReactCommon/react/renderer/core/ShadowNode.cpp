@@ -16,6 +16,7 @@
 #include <react/renderer/debug/DebugStringConvertible.h>
 #include <react/renderer/debug/debugStringConvertibleUtils.h>
 
+#include <unordered_map>
 #include <utility>
 
 namespace facebook::react {
@@ -227,7 +228,8 @@ void ShadowNode::sealRecursive() const {
 void ShadowNode::appendChild(const ShadowNode::Shared& child) {
   ensureUnsealed();
 
-  cloneChildrenIfShared();
+  // Reserve the slot for `child` so the copied list is not reallocated.
+  cloneChildrenIfShared(1);
   auto& children = const_cast<ShadowNode::ListOfShared&>(*children_);
   children.push_back(child);
 
@@ -266,13 +268,17 @@ void ShadowNode::replaceChild(
   react_native_assert(false && "Child to replace was not found.");
 }
 
-void ShadowNode::cloneChildrenIfShared() {
+void ShadowNode::cloneChildrenIfShared(size_t extraCapacity) {
   if (!traits_.check(ShadowNodeTraits::Trait::ChildrenAreShared)) {
     return;
   }
 
   traits_.unset(ShadowNodeTraits::Trait::ChildrenAreShared);
-  children_ = std::make_shared<ShadowNode::ListOfShared>(*children_);
+
+  auto children = std::make_shared<ShadowNode::ListOfShared>();
+  children->reserve(children_->size() + extraCapacity);
+  children->insert(children->end(), children_->begin(), children_->end());
+  children_ = std::move(children);
 }
 
 void ShadowNode::setMounted(bool mounted) const {
@@ -343,18 +349,120 @@ ShadowNode::Unshared ShadowNode::cloneTree(
     auto& parentNode = it->first.get();
     auto childIndex = it->second;
 
-    auto children = parentNode.getChildren();
+    // The list of children is copied exactly once per ancestor: for wide
+    // parents (e.g. long lists) the copy and its reference count bumps
+    // dominate the cost of the clone.
+    auto children =
+        std::make_shared<ShadowNode::ListOfShared>(parentNode.getChildren());
     react_native_assert(
-        ShadowNode::sameFamily(*children.at(childIndex), *childNode));
-    children[childIndex] = childNode;
+        ShadowNode::sameFamily(*children->at(childIndex), *childNode));
+    (*children)[childIndex] = std::move(childNode);
 
-    childNode = parentNode.clone(
-        {.children = std::make_shared<ShadowNode::ListOfShared>(children)});
+    childNode = parentNode.clone({.children = std::move(children)});
   }
 
   return std::const_pointer_cast<ShadowNode>(childNode);
 }
 
+namespace {
+
+ShadowNode::Unshared cloneMultipleRecursive(
+    const ShadowNode& shadowNode,
+    const std::unordered_set<const ShadowNodeFamily*>& familiesToUpdate,
+    const std::unordered_map<const ShadowNodeFamily*, int>& childrenCount,
+    const std::function<ShadowNode::Unshared(
+        const ShadowNode& oldShadowNode,
+        const ShadowNodeFragment& fragment)>& callback) {
+  const auto* family = &shadowNode.getFamily();
+  const auto& children = shadowNode.getChildren();
+
+  // The children vector is only copied if some descendant gets cloned.
+  std::shared_ptr<ShadowNode::ListOfShared> newChildren;
+  auto count = childrenCount.at(family);
+  for (size_t i = 0; count > 0 && i < children.size(); i++) {
+    const auto& child = children[i];
+    if (!childrenCount.contains(&child->getFamily())) {
+      continue;
+    }
+    count--;
+
+    auto newChild = cloneMultipleRecursive(
+        *child, familiesToUpdate, childrenCount, callback);
+    if (!newChild) {
+      continue;
+    }
+    if (!newChildren) {
+      newChildren = std::make_shared<ShadowNode::ListOfShared>(children);
+    }
+    (*newChildren)[i] = std::move(newChild);
+  }
+
+  auto isUpdated = familiesToUpdate.contains(family);
+  if (!newChildren && !isUpdated) {
+    return nullptr;
+  }
+
+  ShadowNode::SharedListOfShared sharedNewChildren = std::move(newChildren);
+  const auto& fragmentChildren = sharedNewChildren
+      ? sharedNewChildren
+      : ShadowNodeFragment::childrenPlaceholder();
+
+  auto fragment = ShadowNodeFragment{.children = fragmentChildren};
+  if (isUpdated) {
+    auto newShadowNode = callback(shadowNode, fragment);
+    react_native_assert(
+        newShadowNode &&
+        "`callback` returned `nullptr` which is not allowed value.");
+    return newShadowNode;
+  }
+
+  return shadowNode.clone(fragment);
+}
+
+} // namespace
+
+ShadowNode::Unshared ShadowNode::cloneMultiple(
+    const std::unordered_set<const ShadowNodeFamily*>& familiesToUpdate,
+    const std::function<ShadowNode::Unshared(
+        const ShadowNode& oldShadowNode,
+        const ShadowNodeFragment& fragment)>& callback) const {
+  // For every family on the path between `this` node and the families to
+  // update, count how many of its children are on that path too, so that the
+  // traversal can stop scanning siblings as soon as all of them were visited.
+  std::unordered_map<const ShadowNodeFamily*, int> childrenCount;
+  for (const auto* family : familiesToUpdate) {
+    if (childrenCount.contains(family)) {
+      continue;
+    }
+    childrenCount[family] = 0;
+    if (family == family_.get()) {
+      continue;
+    }
+
+    auto ancestor = family->parent_.lock();
+    while (ancestor != nullptr && ancestor != family_) {
+      auto ancestorIt = childrenCount.find(ancestor.get());
+      if (ancestorIt != childrenCount.end()) {
+        ancestorIt->second++;
+        break;
+      }
+      childrenCount[ancestor.get()] = 1;
+      ancestor = ancestor->parent_.lock();
+    }
+
+    if (ancestor == family_) {
+      childrenCount[family_.get()]++;
+    }
+  }
+
+  if (!childrenCount.contains(family_.get())) {
+    return nullptr;
+  }
+
+  return cloneMultipleRecursive(
+      *this, familiesToUpdate, childrenCount, callback);
+}
+
 #pragma mark - DebugStringConvertible
 
 #if RN_DEBUG_STRING_CONVERTIBLE
@@ -11,6 +11,7 @@
 #include <memory>
 #include <string>
 #include <type_traits>
+#include <unordered_set>
 #include <vector>
 
 #include <react/renderer/core/EventEmitter.h>
@@ -105,6 +106,25 @@ class ShadowNode : public Sealable,
       const std::function<Unshared(const ShadowNode& oldShadowNode)>& callback)
       const;
 
+  /*
+   * Clones the node (and partially the tree starting from the node) by
+   * replacing the nodes of all the given `familiesToUpdate` with the nodes
+   * that `callback` returns. Unlike calling `cloneTree` for each family, the
+   * minimal spine of ancestors is built in a single pass, and ancestors shared
+   * by several families are cloned only once.
+   *
+   * `callback` is called bottom-up with the old node and a fragment holding
+   * its new children (or the children placeholder if none of its descendants
+   * were cloned). It must return a new node.
+   *
+   * Returns `nullptr` if none of the families are found in the tree.
+   */
+  Unshared cloneMultiple(
+      const std::unordered_set<const ShadowNodeFamily*>& familiesToUpdate,
+      const std::function<Unshared(
+          const ShadowNode& oldShadowNode,
+          const ShadowNodeFragment& fragment)>& callback) const;
+
 #pragma mark - Getters
 
   ComponentName getComponentName() const;
@@ -226,9 +246,10 @@ class ShadowNode : public Sealable,
 
   /*
    * Clones the list of children (and creates a new `shared_ptr` to it) if
-   * `childrenAreShared_` flag is `true`.
+   * `childrenAreShared_` flag is `true`. The new list has room for
+   * `extraCapacity` more children.
    */
-  void cloneChildrenIfShared();
+  void cloneChildrenIfShared(size_t extraCapacity = 0);
 
   /*
    * Pointer to a family object that this shadow node belongs to.
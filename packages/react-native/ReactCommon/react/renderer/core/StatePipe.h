@@ -8,6 +8,7 @@
 #pragma once
 
 #include <functional>
+#include <vector>
 
 #include <react/renderer/core/StateUpdate.h>
 
@@ -15,4 +16,11 @@ namespace facebook::react {
 
 using StatePipe = std::function<void(const StateUpdate& stateUpdate)>;
 
+/*
+ * Delivers several state updates at once, allowing them to be applied in a
+ * single commit.
+ */
+using StateBatchPipe =
+    std::function<void(std::vector<StateUpdate>&& stateUpdates)>;
+
 } // namespace facebook::react
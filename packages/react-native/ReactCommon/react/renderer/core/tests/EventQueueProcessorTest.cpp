@@ -47,17 +47,44 @@ class EventQueueProcessorTest : public testing::Test {
     };
 
     auto dummyEventPipeConclusion = [](jsi::Runtime& runtime) {};
-    auto dummyStatePipe = [](const StateUpdate& stateUpdate) {};
     auto mockEventLogger = std::make_shared<MockEventLogger>();
 
     eventProcessor_ = std::make_unique<EventQueueProcessor>(
-        eventPipe, dummyEventPipeConclusion, dummyStatePipe, mockEventLogger);
+        eventPipe,
+        dummyEventPipeConclusion,
+        statePipe_,
+        [this](std::vector<StateUpdate>&& stateUpdates) {
+          std::vector<int> batch;
+          for (const auto& stateUpdate : stateUpdates) {
+            batch.push_back(getStateUpdateId(stateUpdate));
+          }
+          stateBatches_.push_back(std::move(batch));
+        },
+        mockEventLogger);
   }
 
+  // State updates are identified by the data their callback returns.
+  static StateUpdate makeStateUpdate(int id) {
+    return StateUpdate{
+        nullptr, [id](const StateData::Shared& /*data*/) -> StateData::Shared {
+          return std::make_shared<int>(id);
+        }};
+  }
+
+  static int getStateUpdateId(const StateUpdate& stateUpdate) {
+    return *std::static_pointer_cast<const int>(stateUpdate.callback(nullptr));
+  }
+
+  StatePipe statePipe_ = [this](const StateUpdate& stateUpdate) {
+    stateUpdates_.push_back(getStateUpdateId(stateUpdate));
+  };
+
   std::unique_ptr<facebook::hermes::HermesRuntime> runtime_;
   std::unique_ptr<EventQueueProcessor> eventProcessor_;
   std::vector<std::string> eventTypes_;
   std::vector<ReactEventPriority> eventPriorities_;
+  std::vector<int> stateUpdates_;
+  std::vector<std::vector<int>> stateBatches_;
   ValueFactory dummyValueFactory_;
 };
 
@@ -148,4 +175,36 @@ TEST_F(EventQueueProcessorTest, alwaysDiscreteEvent) {
   EXPECT_EQ(eventPriorities_[0], ReactEventPriority::Discrete);
 }
 
+TEST_F(EventQueueProcessorTest, singleStateUpdate) {
+  eventProcessor_->flushStateUpdates({makeStateUpdate(1)});
+
+  EXPECT_EQ(stateUpdates_, (std::vector<int>{1}));
+  EXPECT_TRUE(stateBatches_.empty());
+}
+
+TEST_F(EventQueueProcessorTest, batchedStateUpdates) {
+  eventProcessor_->flushStateUpdates(
+      {makeStateUpdate(3), makeStateUpdate(1), makeStateUpdate(2)});
+
+  EXPECT_TRUE(stateUpdates_.empty());
+  EXPECT_EQ(stateBatches_, (std::vector<std::vector<int>>{{3, 1, 2}}));
+}
+
+TEST_F(EventQueueProcessorTest, stateUpdatesWithoutBatchPipe) {
+  auto eventProcessor = EventQueueProcessor(
+      [](jsi::Runtime& /*runtime*/,
+         const EventTarget* /*eventTarget*/,
+         const std::string& /*type*/,
+         ReactEventPriority /*priority*/,
+         const EventPayload& /*payload*/) {},
+      [](jsi::Runtime& /*runtime*/) {},
+      statePipe_,
+      nullptr,
+      std::weak_ptr<EventLogger>{});
+
+  eventProcessor.flushStateUpdates({makeStateUpdate(1), makeStateUpdate(2)});
+
+  EXPECT_EQ(stateUpdates_, (std::vector<int>{1, 2}));
+}
+
 } // namespace facebook::react
@@ -1146,3 +1146,79 @@ TEST(LayoutableShadowNodeTest, inversedContentOriginOffset) {
   EXPECT_EQ(relativeLayoutMetrics.frame.origin.x, 180);
   EXPECT_EQ(relativeLayoutMetrics.frame.origin.y, 130);
 }
+
+/*
+ * ┌────────────────────────┐
+ * │<Root>                  │
+ * │ ┌─────────────────────┐│
+ * │ │ <View>              ││
+ * │ │                     ││
+ * │ └─────────────────────┘│
+ * └────────────────────────┘
+ */
+TEST(LayoutableShadowNodeTest, relativeLayoutMetricsAreMemoizedPerRevision) {
+  auto builder = simpleComponentBuilder();
+  auto childShadowNode = std::shared_ptr<ViewShadowNode>{};
+  // clang-format off
+  auto element =
+    Element<RootShadowNode>()
+      .finalize([](RootShadowNode &shadowNode){
+        auto layoutMetrics = EmptyLayoutMetrics;
+        layoutMetrics.frame.size = {900, 900};
+        shadowNode.setLayoutMetrics(layoutMetrics);
+      })
+      .children({
+        Element<ViewShadowNode>()
+        .reference(childShadowNode)
+        .finalize([](ViewShadowNode &shadowNode){
+          auto layoutMetrics = EmptyLayoutMetrics;
+          layoutMetrics.frame.origin = {10, 20};
+          layoutMetrics.frame.size = {100, 200};
+          shadowNode.setLayoutMetrics(layoutMetrics);
+        })
+    });
+  // clang-format on
+
+  auto rootShadowNode = builder.build(element);
+
+  // The cache is disabled until the revision is committed.
+  EXPECT_EQ(rootShadowNode->getRelativeLayoutMetricsCache(), nullptr);
+
+  rootShadowNode->enableRelativeLayoutMetricsCache();
+  auto cache = rootShadowNode->getRelativeLayoutMetricsCache();
+  ASSERT_NE(cache, nullptr);
+
+  auto relativeLayoutMetrics =
+      LayoutableShadowNode::computeRelativeLayoutMetrics(
+          childShadowNode->getFamily(), *rootShadowNode, {});
+
+  EXPECT_EQ(cache->getNumberOfHits(), 0);
+  EXPECT_EQ(cache->getNumberOfMisses(), 1);
+
+  auto memoizedLayoutMetrics =
+      LayoutableShadowNode::computeRelativeLayoutMetrics(
+          childShadowNode->getFamily(), *rootShadowNode, {});
+
+  EXPECT_EQ(memoizedLayoutMetrics, relativeLayoutMetrics);
+  EXPECT_EQ(memoizedLayoutMetrics.frame.origin.x, 10);
+  EXPECT_EQ(memoizedLayoutMetrics.frame.origin.y, 20);
+  EXPECT_EQ(cache->getNumberOfHits(), 1);
+  EXPECT_EQ(cache->getNumberOfMisses(), 1);
+
+  // A different policy is a different entry.
+  LayoutableShadowNode::computeRelativeLayoutMetrics(
+      childShadowNode->getFamily(),
+      *rootShadowNode,
+      {.includeTransform = false});
+
+  EXPECT_EQ(cache->getNumberOfHits(), 1);
+  EXPECT_EQ(cache->getNumberOfMisses(), 2);
+
+  // The entries are shared with consumers which provide ancestors directly.
+  auto ancestors = childShadowNode->getFamily().getAncestors(*rootShadowNode);
+  EXPECT_EQ(
+      LayoutableShadowNode::computeRelativeLayoutMetrics(ancestors, {}),
+      relativeLayoutMetrics);
+  EXPECT_EQ(cache->getNumberOfHits(), 2);
+  EXPECT_EQ(cache->getNumberOfMisses(), 2);
+}
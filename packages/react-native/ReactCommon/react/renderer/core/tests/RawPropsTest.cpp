@@ -5,7 +5,10 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <atomic>
 #include <memory>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <hermes/hermes.h>
@@ -149,6 +152,30 @@ class PropsMultiLookup : public Props {
   const float derivedFloatValue{40};
 };
 
+class PropsCountingInstances : public Props {
+ public:
+  PropsCountingInstances() = default;
+  PropsCountingInstances(
+      const PropsParserContext& context,
+      const PropsCountingInstances& sourceProps,
+      const RawProps& rawProps)
+      : intValue(convertRawProp(
+            context,
+            rawProps,
+            "intValue",
+            sourceProps.intValue,
+            42)) {
+    numberOfInstances++;
+  }
+
+  static std::atomic<int> numberOfInstances;
+
+ private:
+  const int intValue{42};
+};
+
+std::atomic<int> PropsCountingInstances::numberOfInstances{0};
+
 TEST(RawPropsTest, handleProps) {
   ContextContainer contextContainer{};
   PropsParserContext parserContext{-1, contextContainer};
@@ -372,6 +399,30 @@ TEST(RawPropsTest, handlePropsMultiLookup) {
   EXPECT_NEAR(props->derivedFloatValue, 20.0, 0.00001);
 }
 
+TEST(RawPropsTest, prepareParserOnFirstUse) {
+  auto parser = RawPropsParser();
+  parser.prepare<PropsCountingInstances>();
+
+  // Preparation (which constructs a Props object) is deferred until the
+  // parser is used.
+  EXPECT_EQ(PropsCountingInstances::numberOfInstances, 0);
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; i++) {
+    threads.emplace_back([&parser, i] {
+      auto raw = RawProps(folly::dynamic::object("intValue", i));
+      raw.parse(parser);
+      EXPECT_EQ((int)*raw.at("intValue", nullptr, nullptr), i);
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // The parser was prepared once.
+  EXPECT_EQ(PropsCountingInstances::numberOfInstances, 1);
+}
+
 TEST(RawPropsTest, copyDynamicRawProps) {
   ContextContainer contextContainer{};
   PropsParserContext parserContext{-1, contextContainer};
@@ -325,3 +325,68 @@ TEST_P(ShadowNodeTest, handleRuntimeReferenceTransferOnClone) {
     EXPECT_EQ(wrappedShadowNode->shadowNode, nodeABRev1);
   }
 }
+
+TEST_P(ShadowNodeTest, handleCloneMultiple) {
+  auto clonedFamilies = std::vector<const ShadowNodeFamily*>{};
+  auto newNodeA = nodeA_->cloneMultiple(
+      {&nodeABA_->getFamily(), &nodeAC_->getFamily()},
+      [&](const ShadowNode& oldShadowNode, const ShadowNodeFragment& fragment) {
+        clonedFamilies.push_back(&oldShadowNode.getFamily());
+        return oldShadowNode.clone(fragment);
+      });
+
+  ASSERT_NE(newNodeA, nullptr);
+  EXPECT_EQ(clonedFamilies.size(), 2);
+
+  const auto& newChildrenA = newNodeA->getChildren();
+  ASSERT_EQ(newChildrenA.size(), 3);
+  // Untouched subtrees are shared with the original tree.
+  EXPECT_EQ(newChildrenA.at(0), nodeAA_);
+  EXPECT_NE(newChildrenA.at(1), nodeAB_);
+  EXPECT_NE(newChildrenA.at(2), nodeAC_);
+  EXPECT_TRUE(ShadowNode::sameFamily(*newChildrenA.at(2), *nodeAC_));
+
+  const auto& newChildrenAB = newChildrenA.at(1)->getChildren();
+  ASSERT_EQ(newChildrenAB.size(), 2);
+  EXPECT_NE(newChildrenAB.at(0), nodeABA_);
+  EXPECT_TRUE(ShadowNode::sameFamily(*newChildrenAB.at(0), *nodeABA_));
+  EXPECT_EQ(newChildrenAB.at(1), nodeABB_);
+
+  // The original tree is not affected.
+  EXPECT_EQ(nodeA_->getChildren().at(1), nodeAB_);
+  EXPECT_EQ(nodeAB_->getChildren().at(0), nodeABA_);
+}
+
+TEST_P(ShadowNodeTest, handleCloneMultipleWithAncestorAndDescendant) {
+  auto newNodeA = nodeA_->cloneMultiple(
+      {&nodeAB_->getFamily(), &nodeABB_->getFamily()},
+      [&](const ShadowNode& oldShadowNode, const ShadowNodeFragment& fragment) {
+        if (ShadowNode::sameFamily(oldShadowNode, *nodeAB_)) {
+          // The descendant was already cloned and is passed in the fragment.
+          EXPECT_NE(
+              fragment.children, ShadowNodeFragment::childrenPlaceholder());
+          EXPECT_NE(fragment.children->at(1), nodeABB_);
+        } else {
+          EXPECT_EQ(
+              fragment.children, ShadowNodeFragment::childrenPlaceholder());
+        }
+        return oldShadowNode.clone(fragment);
+      });
+
+  ASSERT_NE(newNodeA, nullptr);
+  const auto& newNodeAB = newNodeA->getChildren().at(1);
+  EXPECT_NE(newNodeAB, nodeAB_);
+  EXPECT_EQ(newNodeAB->getChildren().at(0), nodeABA_);
+  EXPECT_NE(newNodeAB->getChildren().at(1), nodeABB_);
+}
+
+TEST_P(ShadowNodeTest, handleCloneMultipleWithoutMatches) {
+  auto callback = [](const ShadowNode& oldShadowNode,
+                     const ShadowNodeFragment& fragment) {
+    return oldShadowNode.clone(fragment);
+  };
+
+  EXPECT_EQ(nodeA_->cloneMultiple({}, callback), nullptr);
+  EXPECT_EQ(nodeA_->cloneMultiple({&nodeZ_->getFamily()}, callback), nullptr);
+  EXPECT_EQ(nodeAB_->cloneMultiple({&nodeAC_->getFamily()}, callback), nullptr);
+}
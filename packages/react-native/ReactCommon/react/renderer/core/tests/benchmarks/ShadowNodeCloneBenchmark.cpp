@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <benchmark/benchmark.h>
+#include <react/renderer/core/ShadowNode.h>
+#include <react/renderer/core/ShadowNodeFragment.h>
+#include <algorithm>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+#include "../TestComponent.h"
+
+namespace facebook::react {
+
+namespace {
+
+constexpr int kDepth = 12;
+constexpr int kBranching = 10;
+
+auto eventDispatcher = std::shared_ptr<const EventDispatcher>{nullptr};
+auto componentDescriptor = TestComponentDescriptor({eventDispatcher});
+auto props = std::make_shared<const TestProps>();
+Tag nextTag = 1;
+
+/*
+ * Builds a "spine" tree: every level has `kBranching` leaf siblings and one
+ * child which continues the spine, which mimics deep view hierarchies with
+ * wide containers (lists, scroll views). Collects the leaves into `leaves`.
+ */
+ShadowNode::Shared buildTree(
+    int depth,
+    std::vector<const ShadowNodeFamily*>& leaves) {
+  auto children = std::make_shared<ShadowNode::ListOfShared>();
+  if (depth > 0) {
+    for (int i = 0; i < kBranching; i++) {
+      auto leaf = buildTree(0, leaves);
+      leaves.push_back(&leaf->getFamily());
+      children->push_back(leaf);
+    }
+    children->push_back(buildTree(depth - 1, leaves));
+  }
+
+  auto family = componentDescriptor.createFamily(
+      ShadowNodeFamilyFragment{nextTag++, 1, nullptr});
+  return std::make_shared<TestShadowNode>(
+      ShadowNodeFragment{props, children}, family, TestShadowNode::BaseTraits());
+}
+
+std::vector<const ShadowNodeFamily*> leaves;
+auto rootNode = buildTree(kDepth, leaves);
+
+// Picks `count` leaves evenly spread across all the levels of the tree.
+std::vector<const ShadowNodeFamily*> pickLeaves(size_t count) {
+  std::vector<const ShadowNodeFamily*> result;
+  auto step = std::max<size_t>(1, leaves.size() / count);
+  for (size_t i = 0; i < leaves.size() && result.size() < count; i += step) {
+    result.push_back(leaves[i]);
+  }
+  return result;
+}
+
+// A scroll view content container of a long feed: a single, very wide parent.
+std::vector<const ShadowNodeFamily*> wideLeaves;
+ShadowNode::Shared buildWideTree(size_t childrenCount) {
+  auto children = std::make_shared<ShadowNode::ListOfShared>();
+  for (size_t i = 0; i < childrenCount; i++) {
+    auto leaf = buildTree(0, wideLeaves);
+    wideLeaves.push_back(&leaf->getFamily());
+    children->push_back(leaf);
+  }
+
+  auto family = componentDescriptor.createFamily(
+      ShadowNodeFamilyFragment{nextTag++, 1, nullptr});
+  return std::make_shared<TestShadowNode>(
+      ShadowNodeFragment{props, children}, family, TestShadowNode::BaseTraits());
+}
+
+auto wideRootNode = buildWideTree(5000);
+
+} // namespace
+
+static void cloneTreeForEachFamily(benchmark::State& state) {
+  auto families = pickLeaves(state.range(0));
+  for (auto _ : state) {
+    auto newRootNode = rootNode;
+    for (const auto* family : families) {
+      newRootNode =
+          newRootNode->cloneTree(*family, [](const ShadowNode& oldShadowNode) {
+            return oldShadowNode.clone({});
+          });
+    }
+    benchmark::DoNotOptimize(newRootNode);
+  }
+}
+BENCHMARK(cloneTreeForEachFamily)->Arg(1)->Arg(8)->Arg(32)->Arg(100);
+
+static void cloneMultipleFamilies(benchmark::State& state) {
+  auto families = pickLeaves(state.range(0));
+  auto familySet = std::unordered_set<const ShadowNodeFamily*>(
+      families.begin(), families.end());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(rootNode->cloneMultiple(
+        familySet,
+        [](const ShadowNode& oldShadowNode,
+           const ShadowNodeFragment& fragment) {
+          return oldShadowNode.clone(fragment);
+        }));
+  }
+}
+BENCHMARK(cloneMultipleFamilies)->Arg(1)->Arg(8)->Arg(32)->Arg(100);
+
+static void cloneTreeInWideParent(benchmark::State& state) {
+  const auto& family = *wideLeaves[wideLeaves.size() / 2];
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        wideRootNode->cloneTree(family, [](const ShadowNode& oldShadowNode) {
+          return oldShadowNode.clone({});
+        }));
+  }
+}
+BENCHMARK(cloneTreeInWideParent);
+
+static void appendChildToWideParent(benchmark::State& state) {
+  auto newChild = wideRootNode->getChildren().front();
+  for (auto _ : state) {
+    auto newRootNode = wideRootNode->clone({});
+    newRootNode->appendChild(newChild);
+    benchmark::DoNotOptimize(newRootNode);
+  }
+}
+BENCHMARK(appendChildToWideParent);
+
+} // namespace facebook::react
+
+BENCHMARK_MAIN();
@@ -7,6 +7,7 @@
 
 #include "Transform.h"
 
+#include <array>
 #include <cmath>
 
 #include <glog/logging.h>
@@ -15,6 +16,74 @@
 
 namespace facebook::react {
 
+namespace {
+
+constexpr std::array<Float, 16> kIdentityMatrix{
+    {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1}};
+
+bool isIdentityMatrix(const std::array<Float, 16>& matrix) {
+  return matrix == kIdentityMatrix;
+}
+
+/*
+ * Returns `true` if the matrix only transforms the XY plane, i.e. it has the
+ * `[a b 0 0; c d 0 0; 0 0 1 0; tx ty 0 1]` form. Such matrices (translations,
+ * scales, Z rotations and skews) are the vast majority in practice and can be
+ * multiplied and applied using 6 elements instead of 16.
+ */
+bool isAffine2DMatrix(const std::array<Float, 16>& matrix) {
+  return matrix[2] == 0 && matrix[3] == 0 && matrix[6] == 0 &&
+      matrix[7] == 0 && matrix[8] == 0 && matrix[9] == 0 && matrix[10] == 1 &&
+      matrix[11] == 0 && matrix[14] == 0 && matrix[15] == 1;
+}
+
+/*
+ * Computes `rhs x lhs` (row-vector convention, so `lhs` is applied first).
+ * Every output row is a linear combination of four contiguous `lhs` rows,
+ * which compilers turn into SIMD multiply-adds on both SSE and NEON.
+ */
+void multiplyMatrices(
+    const std::array<Float, 16>& lhs,
+    const std::array<Float, 16>& rhs,
+    std::array<Float, 16>& result) {
+  for (int i = 0; i < 4; i++) {
+    const auto rhs0 = rhs[i * 4 + 0];
+    const auto rhs1 = rhs[i * 4 + 1];
+    const auto rhs2 = rhs[i * 4 + 2];
+    const auto rhs3 = rhs[i * 4 + 3];
+    for (int j = 0; j < 4; j++) {
+      result[i * 4 + j] = rhs0 * lhs[j] + rhs1 * lhs[4 + j] +
+          rhs2 * lhs[8 + j] + rhs3 * lhs[12 + j];
+    }
+  }
+}
+
+/*
+ * Same as `multiplyMatrices` for matrices for which `isAffine2DMatrix` holds.
+ */
+void multiplyAffine2DMatrices(
+    const std::array<Float, 16>& lhs,
+    const std::array<Float, 16>& rhs,
+    std::array<Float, 16>& result) {
+  result = kIdentityMatrix;
+  result[0] = rhs[0] * lhs[0] + rhs[1] * lhs[4];
+  result[1] = rhs[0] * lhs[1] + rhs[1] * lhs[5];
+  result[4] = rhs[4] * lhs[0] + rhs[5] * lhs[4];
+  result[5] = rhs[4] * lhs[1] + rhs[5] * lhs[5];
+  result[12] = rhs[12] * lhs[0] + rhs[13] * lhs[4] + lhs[12];
+  result[13] = rhs[12] * lhs[1] + rhs[13] * lhs[5] + lhs[13];
+}
+
+Point applyAffine2DMatrix(
+    const std::array<Float, 16>& matrix,
+    const Point& point) {
+  return {
+      point.x * matrix[0] + point.y * matrix[4] + matrix[12],
+      point.x * matrix[1] + point.y * matrix[5] + matrix[13]};
+}
+
+} // namespace
+
 #if RN_DEBUG_STRING_CONVERTIBLE
 void Transform::print(const Transform& t, std::string prefix) {
   LOG(ERROR) << prefix << "[ " << t.matrix[0] << " " << t.matrix[1] << " "
@@ -335,12 +404,12 @@ bool Transform::operator!=(const Transform& rhs) const {
 }
 
 Transform Transform::operator*(const Transform& rhs) const {
-  if (*this == Transform::Identity()) {
+  if (operations.empty() && isIdentityMatrix(matrix)) {
     return rhs;
   }
 
-  const auto& lhs = *this;
   auto result = Transform{};
+  result.operations.reserve(operations.size() + rhs.operations.size());
   for (const auto& op : this->operations) {
     if (op.type == TransformOperationType::Identity &&
         !result.operations.empty()) {
@@ -356,58 +425,11 @@ Transform Transform::operator*(const Transform& rhs) const {
     result.operations.push_back(op);
   }
 
-  auto lhs00 = lhs.matrix[0];
-  auto lhs01 = lhs.matrix[1];
-  auto lhs02 = lhs.matrix[2];
-  auto lhs03 = lhs.matrix[3];
-  auto lhs10 = lhs.matrix[4];
-  auto lhs11 = lhs.matrix[5];
-  auto lhs12 = lhs.matrix[6];
-  auto lhs13 = lhs.matrix[7];
-  auto lhs20 = lhs.matrix[8];
-  auto lhs21 = lhs.matrix[9];
-  auto lhs22 = lhs.matrix[10];
-  auto lhs23 = lhs.matrix[11];
-  auto lhs30 = lhs.matrix[12];
-  auto lhs31 = lhs.matrix[13];
-  auto lhs32 = lhs.matrix[14];
-  auto lhs33 = lhs.matrix[15];
-
-  auto rhs0 = rhs.matrix[0];
-  auto rhs1 = rhs.matrix[1];
-  auto rhs2 = rhs.matrix[2];
-  auto rhs3 = rhs.matrix[3];
-  result.matrix[0] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[1] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[2] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[3] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
-  rhs0 = rhs.matrix[4];
-  rhs1 = rhs.matrix[5];
-  rhs2 = rhs.matrix[6];
-  rhs3 = rhs.matrix[7];
-  result.matrix[4] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[5] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[6] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[7] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
-  rhs0 = rhs.matrix[8];
-  rhs1 = rhs.matrix[9];
-  rhs2 = rhs.matrix[10];
-  rhs3 = rhs.matrix[11];
-  result.matrix[8] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[9] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[10] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[11] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
-
-  rhs0 = rhs.matrix[12];
-  rhs1 = rhs.matrix[13];
-  rhs2 = rhs.matrix[14];
-  rhs3 = rhs.matrix[15];
-  result.matrix[12] = rhs0 * lhs00 + rhs1 * lhs10 + rhs2 * lhs20 + rhs3 * lhs30;
-  result.matrix[13] = rhs0 * lhs01 + rhs1 * lhs11 + rhs2 * lhs21 + rhs3 * lhs31;
-  result.matrix[14] = rhs0 * lhs02 + rhs1 * lhs12 + rhs2 * lhs22 + rhs3 * lhs32;
-  result.matrix[15] = rhs0 * lhs03 + rhs1 * lhs13 + rhs2 * lhs23 + rhs3 * lhs33;
+  if (isAffine2DMatrix(matrix) && isAffine2DMatrix(rhs.matrix)) {
+    multiplyAffine2DMatrices(matrix, rhs.matrix, result.matrix);
+  } else {
+    multiplyMatrices(matrix, rhs.matrix, result.matrix);
+  }
 
   return result;
 }
@@ -421,10 +443,14 @@ const Float& Transform::at(int i, int j) const {
 }
 
 Point operator*(const Point& point, const Transform& transform) {
-  if (transform == Transform::Identity()) {
+  if (isIdentityMatrix(transform.matrix)) {
     return point;
   }
 
+  if (isAffine2DMatrix(transform.matrix)) {
+    return applyAffine2DMatrix(transform.matrix, point);
+  }
+
   auto result = transform * Vector{point.x, point.y, 0, 1};
 
   return {result.x, result.y};
@@ -441,6 +467,14 @@ Rect Transform::applyWithCenter(const Rect& rect, const Point& center) const {
   auto c = Point{rect.getMaxX(), rect.getMaxY()} - center;
   auto d = Point{rect.origin.x, rect.getMaxY()} - center;
 
+  if (isAffine2DMatrix(matrix)) {
+    return Rect::boundingRect(
+        applyAffine2DMatrix(matrix, a) + center,
+        applyAffine2DMatrix(matrix, b) + center,
+        applyAffine2DMatrix(matrix, c) + center,
+        applyAffine2DMatrix(matrix, d) + center);
+  }
+
   auto vectorA = *this * Vector{a.x, a.y, 0, 1};
   auto vectorB = *this * Vector{b.x, b.y, 0, 1};
   auto vectorC = *this * Vector{c.x, c.y, 0, 1};
@@ -477,7 +511,7 @@ Vector operator*(const Transform& transform, const Vector& vector) {
 }
 
 Size operator*(const Size& size, const Transform& transform) {
-  if (transform == Transform::Identity()) {
+  if (isIdentityMatrix(transform.matrix)) {
     return size;
   }
 
@@ -8,8 +8,8 @@
 #pragma once
 
 #include <array>
-#include <vector>
 
+#include <folly/small_vector.h>
 #include <react/renderer/graphics/Float.h>
 #include <react/renderer/graphics/Point.h>
 #include <react/renderer/graphics/RectangleEdges.h>
@@ -84,7 +84,10 @@ struct TransformOrigin {
  * Defines transform matrix to apply affine transformations.
  */
 struct Transform {
-  std::vector<TransformOperation> operations{};
+  /*
+   * Most transforms consist of a single operation, so it's stored inline.
+   */
+  folly::small_vector<TransformOperation, 1> operations{};
 
   std::array<Float, 16> matrix{
       {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1}};
@@ -134,3 +134,31 @@ TEST(TransformTest, scalingAndTranslatingRect) {
   EXPECT_EQ(transformedRect.size.width, 150);
   EXPECT_EQ(transformedRect.size.height, 200);
 }
+
+TEST(TransformTest, multiplyingAffineTransforms) {
+  auto point = facebook::react::Point{1, 1};
+
+  auto transform = Transform::Translate(10, 20, 0) * Transform::Scale(2, 2, 1);
+  auto transformedPoint = point * transform;
+
+  EXPECT_EQ(transformedPoint.x, 22);
+  EXPECT_EQ(transformedPoint.y, 42);
+  EXPECT_EQ(transform.operations.size(), 2);
+  EXPECT_EQ(transform.operations[0].type, TransformOperationType::Translate);
+  EXPECT_EQ(transform.operations[1].type, TransformOperationType::Scale);
+}
+
+TEST(TransformTest, multiplyingAffineAndNonAffineTransforms) {
+  auto point = facebook::react::Point{1, 1};
+
+  auto affineTransform = Transform::Translate(10, 20, 0);
+  auto nonAffineTransform = Transform::Scale(2, 2, 2);
+
+  auto transformedPoint = point * (affineTransform * nonAffineTransform);
+  EXPECT_EQ(transformedPoint.x, 22);
+  EXPECT_EQ(transformedPoint.y, 42);
+
+  transformedPoint = point * (nonAffineTransform * affineTransform);
+  EXPECT_EQ(transformedPoint.x, 12);
+  EXPECT_EQ(transformedPoint.y, 22);
+}
@@ -239,29 +239,56 @@ std::shared_ptr<const MountingCoordinator> ShadowTree::getMountingCoordinator()
 CommitStatus ShadowTree::commit(
     const ShadowTreeCommitTransaction& transaction,
     const CommitOptions& commitOptions) const {
-  [[maybe_unused]] int attempts = 0;
+  int attempts = 0;
+  auto retriesTime = TelemetryDuration{0};
 
   while (true) {
+    auto attemptStartTime = telemetryTimePointNow();
+    auto status = tryCommit(transaction, commitOptions, attempts, retriesTime);
     attempts++;
 
-    auto status = tryCommit(transaction, commitOptions);
     if (status != CommitStatus::Failed) {
       return status;
     }
 
+    retriesTime += telemetryTimePointNow() - attemptStartTime;
+
     // After multiple attempts, we failed to commit the transaction.
     // Something internally went terribly wrong.
     react_native_assert(attempts < 1024);
   }
 }
 
+bool ShadowTree::isCommitBaseStale(
+    ShadowTreeRevision::Number baseRevisionNumber,
+    ShadowTreeRevision::Number baseRevisionNumberWithNewState,
+    const CommitOptions& commitOptions) const {
+  if (ReactNativeFeatureFlags::snapshot()
+          .enableGranularShadowTreeStateReconciliation) {
+    // Commit should only fail if we propagated the wrong state.
+    return commitOptions.enableStateReconciliation &&
+        baseRevisionNumberWithNewState != lastRevisionNumberWithNewState_;
+  }
+
+  return baseRevisionNumber != currentRevision_.number;
+}
+
 CommitStatus ShadowTree::tryCommit(
     const ShadowTreeCommitTransaction& transaction,
     const CommitOptions& commitOptions) const {
-  SystraceSection s("ShadowTree::commit");
+  return tryCommit(transaction, commitOptions, 0, TelemetryDuration{0});
+}
+
+CommitStatus ShadowTree::tryCommit(
+    const ShadowTreeCommitTransaction& transaction,
+    const CommitOptions& commitOptions,
+    int numberOfRetries,
+    TelemetryDuration retriesTime) const {
+  SystraceSection s("ShadowTree::commit", "retries", numberOfRetries);
 
   auto telemetry = TransactionTelemetry{};
   telemetry.willCommit();
+  telemetry.setCommitRetries(numberOfRetries, retriesTime);
 
   CommitMode commitMode;
   auto oldRevision = ShadowTreeRevision{};
@@ -293,13 +320,28 @@ CommitStatus ShadowTree::tryCommit(
   }
 
   // Run commit hooks.
+  telemetry.setAsThreadLocal();
   newRootShadowNode = delegate_.shadowTreeWillCommit(
       *this, oldRootShadowNode, newRootShadowNode);
+  telemetry.unsetAsThreadLocal();
 
   if (!newRootShadowNode) {
     return CommitStatus::Cancelled;
   }
 
+  {
+    // Layout is the most expensive part of the commit, so we bail out before
+    // it if a concurrent commit already made this transaction stale.
+    // The caller will rerun the transaction on top of the new revision.
+    std::shared_lock lock(commitMutex_);
+    if (isCommitBaseStale(
+            oldRevision.number,
+            lastRevisionNumberWithNewState,
+            commitOptions)) {
+      return CommitStatus::Failed;
+    }
+  }
+
   // Layout nodes.
   std::vector<const LayoutableShadowNode*> affectedLayoutableNodes{};
   affectedLayoutableNodes.reserve(1024);
@@ -314,19 +356,11 @@ CommitStatus ShadowTree::tryCommit(
     // Updating `currentRevision_` in unique manner if it hasn't changed.
     std::unique_lock lock(commitMutex_);
 
-    if (ReactNativeFeatureFlags::
-            enableGranularShadowTreeStateReconciliation()) {
-      auto lastRevisionNumberWithNewStateChanged =
-          lastRevisionNumberWithNewState != lastRevisionNumberWithNewState_;
-      // Commit should only fail if we propagated the wrong state.
-      if (commitOptions.enableStateReconciliation &&
-          lastRevisionNumberWithNewStateChanged) {
-        return CommitStatus::Failed;
-      }
-    } else {
-      if (currentRevision_.number != oldRevision.number) {
-        return CommitStatus::Failed;
-      }
+    if (isCommitBaseStale(
+            oldRevision.number,
+            lastRevisionNumberWithNewState,
+            commitOptions)) {
+      return CommitStatus::Failed;
     }
 
     auto newRevisionNumber = currentRevision_.number + 1;
@@ -345,6 +379,10 @@ CommitStatus ShadowTree::tryCommit(
     // Does nothing in release.
     newRootShadowNode->sealRecursive();
 
+    // The layout of the revision is final now, so layout metrics computed
+    // against it can be memoized until the next commit.
+    newRootShadowNode->enableRelativeLayoutMetricsCache();
+
     newRevision = ShadowTreeRevision{
         std::move(newRootShadowNode), newRevisionNumber, telemetry};
 
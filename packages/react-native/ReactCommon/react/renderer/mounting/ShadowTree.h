@@ -131,6 +131,26 @@ class ShadowTree final {
  private:
   constexpr static ShadowTreeRevision::Number INITIAL_REVISION{0};
 
+  /*
+   * Same as the public `tryCommit`, but also reports `numberOfRetries`
+   * previously failed attempts (which took `retriesTime`) to telemetry.
+   */
+  CommitStatus tryCommit(
+      const ShadowTreeCommitTransaction& transaction,
+      const CommitOptions& commitOptions,
+      int numberOfRetries,
+      TelemetryDuration retriesTime) const;
+
+  /*
+   * Returns `true` if a transaction based on the revision with given numbers
+   * can no longer be committed because of a concurrent commit.
+   * Must be called with `commitMutex_` acquired.
+   */
+  bool isCommitBaseStale(
+      ShadowTreeRevision::Number baseRevisionNumber,
+      ShadowTreeRevision::Number baseRevisionNumberWithNewState,
+      const CommitOptions& commitOptions) const;
+
   void mount(ShadowTreeRevision revision, bool mountSynchronously) const;
 
   void emitLayoutEvents(
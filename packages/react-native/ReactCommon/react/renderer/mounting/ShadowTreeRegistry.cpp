@@ -17,51 +17,93 @@ ShadowTreeRegistry::~ShadowTreeRegistry() {
 }
 
 void ShadowTreeRegistry::add(std::unique_ptr<ShadowTree>&& shadowTree) const {
-  std::unique_lock lock(mutex_);
+  auto surfaceId = shadowTree->getSurfaceId();
+  auto entry = std::make_shared<Entry>();
+  entry->shadowTree = std::move(shadowTree);
 
-  registry_.emplace(shadowTree->getSurfaceId(), std::move(shadowTree));
+  std::unique_lock lock(mutex_);
+  registry_.emplace(surfaceId, std::move(entry));
 }
 
 std::unique_ptr<ShadowTree> ShadowTreeRegistry::remove(
     SurfaceId surfaceId) const {
-  std::unique_lock lock(mutex_);
+  auto entry = std::shared_ptr<Entry>{};
 
-  auto iterator = registry_.find(surfaceId);
-  if (iterator == registry_.end()) {
-    return {};
+  {
+    std::unique_lock lock(mutex_);
+
+    auto iterator = registry_.find(surfaceId);
+    if (iterator == registry_.end()) {
+      return {};
+    }
+
+    entry = std::move(iterator->second);
+    registry_.erase(iterator);
   }
 
-  auto shadowTree = std::unique_ptr<ShadowTree>(iterator->second.release());
-  registry_.erase(iterator);
-  return shadowTree;
+  // Waiting for all visitors of this particular surface (which might be in
+  // the middle of a commit) to finish. Visitors which found the entry before
+  // it was unregistered will observe an empty slot afterwards.
+  std::unique_lock lock(entry->mutex);
+  return std::move(entry->shadowTree);
 }
 
 bool ShadowTreeRegistry::visit(
     SurfaceId surfaceId,
     const std::function<void(const ShadowTree& shadowTree)>& callback) const {
-  std::shared_lock lock(mutex_);
-
-  auto iterator = registry_.find(surfaceId);
+  auto entry = findEntry(surfaceId);
+  if (!entry) {
+    return false;
+  }
 
-  if (iterator == registry_.end()) {
+  std::shared_lock lock(entry->mutex);
+  if (!entry->shadowTree) {
     return false;
   }
 
-  callback(*iterator->second);
+  callback(*entry->shadowTree);
   return true;
 }
 
 void ShadowTreeRegistry::enumerate(
     const std::function<void(const ShadowTree& shadowTree, bool& stop)>&
         callback) const {
-  std::shared_lock lock(mutex_);
   auto stop = false;
-  for (const auto& pair : registry_) {
-    callback(*pair.second, stop);
+  for (const auto& entry : getEntries()) {
+    std::shared_lock lock(entry->mutex);
+    if (!entry->shadowTree) {
+      continue;
+    }
+
+    callback(*entry->shadowTree, stop);
     if (stop) {
       return;
     }
   }
 }
 
+std::shared_ptr<const ShadowTreeRegistry::Entry> ShadowTreeRegistry::findEntry(
+    SurfaceId surfaceId) const {
+  std::shared_lock lock(mutex_);
+
+  auto iterator = registry_.find(surfaceId);
+  if (iterator == registry_.end()) {
+    return nullptr;
+  }
+
+  return iterator->second;
+}
+
+std::vector<std::shared_ptr<const ShadowTreeRegistry::Entry>>
+ShadowTreeRegistry::getEntries() const {
+  std::shared_lock lock(mutex_);
+
+  auto entries = std::vector<std::shared_ptr<const Entry>>{};
+  entries.reserve(registry_.size());
+  for (const auto& pair : registry_) {
+    entries.push_back(pair.second);
+  }
+  return entries;
+}
+
 } // namespace facebook::react
@@ -7,8 +7,10 @@
 
 #pragma once
 
+#include <memory>
 #include <shared_mutex>
 #include <unordered_map>
+#include <vector>
 
 #include <react/renderer/core/ReactPrimitives.h>
 #include <react/renderer/mounting/ShadowTree.h>
@@ -41,8 +43,11 @@ class ShadowTreeRegistry final {
 
   /*
    * Finds a `ShadowTree` instance with a given `surfaceId` in the registry and
-   * synchronously calls the `callback` with a reference to the instance while
-   * the mutex is being acquired.
+   * synchronously calls the `callback` with a reference to the instance.
+   * The registry itself is not locked while the `callback` runs, so visiting
+   * (and committing to) one surface does not block adding, removing or
+   * visiting other surfaces; only removing the same surface waits for the
+   * `callback` to finish.
    * Returns `true` if the registry has `ShadowTree` instance with corresponding
    * `surfaceId`, otherwise returns `false` without calling the `callback`.
    * Can be called from any thread.
@@ -54,6 +59,8 @@ class ShadowTreeRegistry final {
   /*
    * Enumerates all stored shadow trees.
    * Set `stop` to `true` to interrupt the enumeration.
+   * Shadow trees added or removed during the enumeration might or might not
+   * be visited.
    * Can be called from any thread.
    */
   void enumerate(
@@ -61,8 +68,22 @@ class ShadowTreeRegistry final {
           callback) const;
 
  private:
+  /*
+   * A slot owning a registered `ShadowTree`. Slots are reference counted, so
+   * visitors can keep using a slot after releasing the registry lock; the
+   * slot lock serializes removal of a `ShadowTree` with its visitors.
+   */
+  struct Entry {
+    mutable std::shared_mutex mutex;
+    std::unique_ptr<ShadowTree> shadowTree; // Protected by `mutex`.
+  };
+
+  std::shared_ptr<const Entry> findEntry(SurfaceId surfaceId) const;
+
+  std::vector<std::shared_ptr<const Entry>> getEntries() const;
+
   mutable std::shared_mutex mutex_;
-  mutable std::unordered_map<SurfaceId, std::unique_ptr<ShadowTree>>
+  mutable std::unordered_map<SurfaceId, std::shared_ptr<Entry>>
       registry_; // Protected by `mutex_`.
 };
 
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <future>
+#include <memory>
+
+#include <gtest/gtest.h>
+#include <react/renderer/components/root/RootShadowNode.h>
+#include <react/renderer/mounting/ShadowTree.h>
+#include <react/renderer/mounting/ShadowTreeRegistry.h>
+
+namespace facebook::react {
+
+namespace {
+
+class FakeShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      const ShadowTree& /*shadowTree*/,
+      const RootShadowNode::Shared& /*oldRootShadowNode*/,
+      const RootShadowNode::Unshared& newRootShadowNode) const override {
+    return newRootShadowNode;
+  };
+
+  void shadowTreeDidFinishTransaction(
+      std::shared_ptr<const MountingCoordinator> /*mountingCoordinator*/,
+      bool /*mountSynchronously*/) const override {};
+};
+
+} // namespace
+
+class ShadowTreeRegistryTest : public ::testing::Test {
+ public:
+  std::unique_ptr<ShadowTree> createShadowTree(SurfaceId surfaceId) {
+    return std::make_unique<ShadowTree>(
+        surfaceId,
+        layoutConstraints_,
+        layoutContext_,
+        shadowTreeDelegate_,
+        contextContainer_);
+  }
+
+  LayoutConstraints layoutConstraints_{};
+  LayoutContext layoutContext_{};
+  FakeShadowTreeDelegate shadowTreeDelegate_{};
+  ContextContainer contextContainer_{};
+  ShadowTreeRegistry shadowTreeRegistry_{};
+};
+
+TEST_F(ShadowTreeRegistryTest, visitAndRemove) {
+  shadowTreeRegistry_.add(createShadowTree(1));
+
+  auto visitedSurfaceId = SurfaceId{-1};
+  EXPECT_TRUE(shadowTreeRegistry_.visit(1, [&](const ShadowTree& shadowTree) {
+    visitedSurfaceId = shadowTree.getSurfaceId();
+  }));
+  EXPECT_EQ(visitedSurfaceId, 1);
+
+  EXPECT_FALSE(
+      shadowTreeRegistry_.visit(2, [](const ShadowTree& /*shadowTree*/) {
+        FAIL() << "Unregistered surfaces must not be visited.";
+      }));
+
+  auto shadowTree = shadowTreeRegistry_.remove(1);
+  ASSERT_NE(shadowTree, nullptr);
+  EXPECT_EQ(shadowTree->getSurfaceId(), 1);
+  EXPECT_EQ(shadowTreeRegistry_.remove(1), nullptr);
+  EXPECT_FALSE(
+      shadowTreeRegistry_.visit(1, [](const ShadowTree& /*shadowTree*/) {}));
+}
+
+TEST_F(ShadowTreeRegistryTest, visitDoesNotBlockOtherSurfaces) {
+  shadowTreeRegistry_.add(createShadowTree(1));
+
+  // Adding and removing another surface from a different thread while a
+  // visitor (e.g. a commit) of the first surface is in flight must not wait
+  // for the visitor to finish.
+  shadowTreeRegistry_.visit(1, [&](const ShadowTree& /*shadowTree*/) {
+    std::async(std::launch::async, [&]() {
+      shadowTreeRegistry_.add(createShadowTree(2));
+      EXPECT_NE(shadowTreeRegistry_.remove(2), nullptr);
+    }).wait();
+  });
+
+  EXPECT_NE(shadowTreeRegistry_.remove(1), nullptr);
+}
+
+TEST_F(ShadowTreeRegistryTest, removeWaitsForVisitorsOfTheSameSurface) {
+  shadowTreeRegistry_.add(createShadowTree(1));
+
+  auto visitorStarted = std::promise<void>{};
+  auto visitorCanFinish = std::promise<void>{};
+  auto visitorFinished = false;
+
+  auto visitor = std::async(std::launch::async, [&]() {
+    shadowTreeRegistry_.visit(1, [&](const ShadowTree& /*shadowTree*/) {
+      visitorStarted.set_value();
+      visitorCanFinish.get_future().wait();
+      visitorFinished = true;
+    });
+  });
+
+  visitorStarted.get_future().wait();
+  auto remover = std::async(std::launch::async, [&]() {
+    return shadowTreeRegistry_.remove(1);
+  });
+
+  visitorCanFinish.set_value();
+  auto shadowTree = remover.get();
+  visitor.wait();
+
+  EXPECT_TRUE(visitorFinished);
+  EXPECT_NE(shadowTree, nullptr);
+}
+
+} // namespace facebook::react
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+#include <react/renderer/components/root/RootShadowNode.h>
+#include <react/renderer/mounting/ShadowTree.h>
+
+namespace facebook::react {
+
+namespace {
+
+class FakeShadowTreeDelegate : public ShadowTreeDelegate {
+ public:
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      const ShadowTree& /*shadowTree*/,
+      const RootShadowNode::Shared& /*oldRootShadowNode*/,
+      const RootShadowNode::Unshared& newRootShadowNode) const override {
+    return newRootShadowNode;
+  };
+
+  void shadowTreeDidFinishTransaction(
+      std::shared_ptr<const MountingCoordinator> /*mountingCoordinator*/,
+      bool /*mountSynchronously*/) const override {};
+};
+
+RootShadowNode::Unshared cloneRootShadowNode(
+    const RootShadowNode& rootShadowNode) {
+  return std::static_pointer_cast<RootShadowNode>(
+      rootShadowNode.ShadowNode::clone({}));
+}
+
+} // namespace
+
+class ShadowTreeTest : public ::testing::Test {
+ public:
+  ShadowTreeTest()
+      : shadowTree_(
+            SurfaceId{1},
+            LayoutConstraints{},
+            LayoutContext{},
+            shadowTreeDelegate_,
+            contextContainer_) {}
+
+  FakeShadowTreeDelegate shadowTreeDelegate_{};
+  ContextContainer contextContainer_{};
+  ShadowTree shadowTree_;
+};
+
+TEST_F(ShadowTreeTest, commitWithoutRetries) {
+  auto status = shadowTree_.commit(cloneRootShadowNode, {});
+
+  EXPECT_EQ(status, CommitStatus::Succeeded);
+  const auto& telemetry = shadowTree_.getCurrentRevision().telemetry;
+  EXPECT_EQ(telemetry.getNumberOfCommitRetries(), 0);
+  EXPECT_EQ(telemetry.getCommitRetriesTime(), TelemetryDuration{0});
+}
+
+TEST_F(ShadowTreeTest, commitReportsRetries) {
+  auto numberOfTransactions = 0;
+  auto status = shadowTree_.commit(
+      [&](const RootShadowNode& oldRootShadowNode) {
+        if (numberOfTransactions++ == 0) {
+          // A concurrent commit makes the base of this transaction stale, so
+          // it has to be retried on top of the new revision.
+          shadowTree_.commit(cloneRootShadowNode, {});
+        }
+        return cloneRootShadowNode(oldRootShadowNode);
+      },
+      {.enableStateReconciliation = true});
+
+  EXPECT_EQ(status, CommitStatus::Succeeded);
+  EXPECT_EQ(numberOfTransactions, 2);
+  const auto& revision = shadowTree_.getCurrentRevision();
+  EXPECT_EQ(revision.number, 2);
+  EXPECT_EQ(revision.telemetry.getNumberOfCommitRetries(), 1);
+  EXPECT_GT(revision.telemetry.getCommitRetriesTime(), TelemetryDuration{0});
+}
+
+} // namespace facebook::react
@@ -111,6 +111,14 @@ RootShadowNode::Unshared MutationObserverManager::shadowTreeWillCommit(
   return newRootShadowNode;
 }
 
+bool MutationObserverManager::isReadOnly() const noexcept {
+  return true;
+}
+
+const char* MutationObserverManager::getCommitHookName() const noexcept {
+  return "MutationObserverManager";
+}
+
 void MutationObserverManager::runMutationObservations(
     const ShadowTree& shadowTree,
     const RootShadowNode& oldRootShadowNode,
@@ -45,6 +45,9 @@ class MutationObserverManager final : public UIManagerCommitHook {
       const RootShadowNode::Shared& oldRootShadowNode,
       const RootShadowNode::Unshared& newRootShadowNode) noexcept override;
 
+  bool isReadOnly() const noexcept override;
+  const char* getCommitHookName() const noexcept override;
+
  private:
   std::unordered_map<
       SurfaceId,
@@ -123,7 +123,7 @@ std::shared_ptr<Task> RuntimeScheduler_Modern::scheduleIdleTask(
 bool RuntimeScheduler_Modern::getShouldYield() noexcept {
   std::shared_lock lock(schedulingMutex_);
 
-  if (ReactNativeFeatureFlags::enableLongTaskAPI()) {
+  if (ReactNativeFeatureFlags::snapshot().enableLongTaskAPI) {
     markYieldingOpportunity(now_());
   }
 
@@ -316,7 +316,9 @@ void RuntimeScheduler_Modern::runEventLoopTick(
   currentTask_ = &task;
   currentPriority_ = task.priority;
 
-  if (ReactNativeFeatureFlags::enableLongTaskAPI()) {
+  const auto& featureFlags = ReactNativeFeatureFlags::snapshot();
+
+  if (featureFlags.enableLongTaskAPI) {
     lastYieldingOpportunity_ = taskStartTime;
     longestPeriodWithoutYieldingOpportunity_ =
         std::chrono::milliseconds::zero();
@@ -328,7 +330,7 @@ void RuntimeScheduler_Modern::runEventLoopTick(
   // "Perform a microtask checkpoint" step.
   performMicrotaskCheckpoint(runtime);
 
-  if (ReactNativeFeatureFlags::enableLongTaskAPI()) {
+  if (featureFlags.enableLongTaskAPI) {
     auto taskEndTime = now_();
     markYieldingOpportunity(taskEndTime);
     reportLongTasks(task, taskStartTime, taskEndTime);
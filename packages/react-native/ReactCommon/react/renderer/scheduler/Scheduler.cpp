@@ -88,13 +88,21 @@ Scheduler::Scheduler(
     uiManager->updateState(stateUpdate);
   };
 
+  auto stateBatchPipe = [uiManager](std::vector<StateUpdate>&& stateUpdates) {
+    uiManager->updateStates(std::move(stateUpdates));
+  };
+
   auto eventBeat = schedulerToolbox.eventBeatFactory(std::move(eventOwnerBox));
 
   // Creating an `EventDispatcher` instance inside the already allocated
   // container (inside the optional).
   eventDispatcher_->emplace(
       EventQueueProcessor(
-          eventPipe, eventPipeConclusion, statePipe, eventPerformanceLogger_),
+          eventPipe,
+          eventPipeConclusion,
+          statePipe,
+          stateBatchPipe,
+          eventPerformanceLogger_),
       std::move(eventBeat),
       statePipe,
       eventPerformanceLogger_);
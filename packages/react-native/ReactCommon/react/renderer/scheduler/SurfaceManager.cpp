@@ -21,9 +21,11 @@ void SurfaceManager::startSurface(
     const LayoutConstraints& layoutConstraints,
     const LayoutContext& layoutContext) const noexcept {
   {
+    auto surfaceHandler =
+        std::make_shared<const SurfaceHandler>(moduleName, surfaceId);
+    surfaceHandler->setContextContainer(scheduler_.getContextContainer());
+
     std::unique_lock lock(mutex_);
-    auto surfaceHandler = SurfaceHandler{moduleName, surfaceId};
-    surfaceHandler.setContextContainer(scheduler_.getContextContainer());
     registry_.emplace(surfaceId, std::move(surfaceHandler));
   }
 
@@ -88,15 +90,21 @@ void SurfaceManager::visit(
     SurfaceId surfaceId,
     const std::function<void(const SurfaceHandler& surfaceHandler)>& callback)
     const noexcept {
-  std::shared_lock lock(mutex_);
+  auto surfaceHandler = std::shared_ptr<const SurfaceHandler>{};
+
+  {
+    std::shared_lock lock(mutex_);
+
+    auto iterator = registry_.find(surfaceId);
 
-  auto iterator = registry_.find(surfaceId);
+    if (iterator == registry_.end()) {
+      return;
+    }
 
-  if (iterator == registry_.end()) {
-    return;
+    surfaceHandler = iterator->second;
   }
 
-  callback(iterator->second);
+  callback(*surfaceHandler);
 }
 
 } // namespace facebook::react
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <memory>
 #include <mutex>
 #include <shared_mutex>
 #include <unordered_map>
@@ -58,9 +59,15 @@ class SurfaceManager final {
       const std::function<void(const SurfaceHandler& surfaceHandler)>& callback)
       const noexcept;
 
+  /*
+   * Handlers are reference counted, so `visit` only holds `mutex_` for the
+   * lookup and never while the callback (which might start, stop or commit to
+   * the surface) runs. `SurfaceHandler` is thread-safe on its own.
+   */
   const Scheduler& scheduler_;
   mutable std::shared_mutex mutex_; // Protects `registry_`.
-  mutable std::unordered_map<SurfaceId, SurfaceHandler> registry_{};
+  mutable std::unordered_map<SurfaceId, std::shared_ptr<const SurfaceHandler>>
+      registry_{};
 };
 
 } // namespace facebook::react
@@ -101,10 +101,29 @@ void TransactionTelemetry::didMount() {
   mountEndTime_ = now_();
 }
 
+void TransactionTelemetry::didRunCommitHook(
+    const char* commitHookName,
+    TelemetryDuration duration) {
+  numberOfCommitHooks_++;
+  commitHooksTime_ += duration;
+  if (slowestCommitHookName_ == nullptr || duration > slowestCommitHookTime_) {
+    slowestCommitHookName_ = commitHookName;
+    slowestCommitHookTime_ = duration;
+  }
+}
+
 void TransactionTelemetry::setRevisionNumber(int revisionNumber) {
   revisionNumber_ = revisionNumber;
 }
 
+void TransactionTelemetry::setCommitRetries(
+    int numberOfCommitRetries,
+    TelemetryDuration commitRetriesTime) {
+  react_native_assert(numberOfCommitRetries >= 0);
+  numberOfCommitRetries_ = numberOfCommitRetries;
+  commitRetriesTime_ = commitRetriesTime;
+}
+
 TelemetryTimePoint TransactionTelemetry::getDiffStartTime() const {
   react_native_assert(diffStartTime_ != kTelemetryUndefinedTimePoint);
   react_native_assert(diffEndTime_ != kTelemetryUndefinedTimePoint);
@@ -157,6 +176,22 @@ TelemetryDuration TransactionTelemetry::getTextMeasureTime() const {
   return textMeasureTime_;
 }
 
+TelemetryDuration TransactionTelemetry::getCommitHooksTime() const {
+  return commitHooksTime_;
+}
+
+int TransactionTelemetry::getNumberOfCommitHooks() const {
+  return numberOfCommitHooks_;
+}
+
+const char* TransactionTelemetry::getSlowestCommitHookName() const {
+  return slowestCommitHookName_;
+}
+
+TelemetryDuration TransactionTelemetry::getSlowestCommitHookTime() const {
+  return slowestCommitHookTime_;
+}
+
 int TransactionTelemetry::getNumberOfTextMeasurements() const {
   return numberOfTextMeasurements_;
 }
@@ -165,6 +200,14 @@ int TransactionTelemetry::getRevisionNumber() const {
   return revisionNumber_;
 }
 
+int TransactionTelemetry::getNumberOfCommitRetries() const {
+  return numberOfCommitRetries_;
+}
+
+TelemetryDuration TransactionTelemetry::getCommitRetriesTime() const {
+  return commitRetriesTime_;
+}
+
 int TransactionTelemetry::getAffectedLayoutNodesCount() const {
   return affectedLayoutNodesCount_;
 }
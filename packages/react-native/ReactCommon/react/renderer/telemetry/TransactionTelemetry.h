@@ -47,8 +47,18 @@ class TransactionTelemetry final {
   void willMount();
   void didMount();
 
+  void didRunCommitHook(const char* commitHookName, TelemetryDuration duration);
+
   void setRevisionNumber(int revisionNumber);
 
+  /*
+   * Records how many previous attempts to commit the transaction failed
+   * because of a concurrent commit, and how much time was spent on them.
+   */
+  void setCommitRetries(
+      int numberOfCommitRetries,
+      TelemetryDuration commitRetriesTime);
+
   /*
    * Reading
    */
@@ -62,8 +72,19 @@ class TransactionTelemetry final {
   TelemetryTimePoint getMountEndTime() const;
 
   TelemetryDuration getTextMeasureTime() const;
+  TelemetryDuration getCommitHooksTime() const;
+  int getNumberOfCommitHooks() const;
+
+  /*
+   * The name of the commit hook which took the most time during the commit,
+   * or `nullptr` if no commit hooks were run.
+   */
+  const char* getSlowestCommitHookName() const;
+  TelemetryDuration getSlowestCommitHookTime() const;
   int getNumberOfTextMeasurements() const;
   int getRevisionNumber() const;
+  int getNumberOfCommitRetries() const;
+  TelemetryDuration getCommitRetriesTime() const;
 
   int getAffectedLayoutNodesCount() const;
 
@@ -80,8 +101,15 @@ class TransactionTelemetry final {
   TelemetryTimePoint lastTextMeasureStartTime_{kTelemetryUndefinedTimePoint};
   TelemetryDuration textMeasureTime_{0};
 
+  TelemetryDuration commitHooksTime_{0};
+  int numberOfCommitHooks_{0};
+  const char* slowestCommitHookName_{nullptr};
+  TelemetryDuration slowestCommitHookTime_{0};
+
   int numberOfTextMeasurements_{0};
   int revisionNumber_{0};
+  int numberOfCommitRetries_{0};
+  TelemetryDuration commitRetriesTime_{0};
   std::function<TelemetryTimePoint()> now_;
 
   int affectedLayoutNodesCount_{0};
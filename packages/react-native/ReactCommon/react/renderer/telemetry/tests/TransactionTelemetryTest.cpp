@@ -133,6 +133,39 @@ TEST(TransactionTelemetryTest, defaultImplementation) {
   EXPECT_GE(mountDuration, 100);
 }
 
+TEST(TransactionTelemetryTest, commitRetries) {
+  auto telemetry = TransactionTelemetry{[]() { return MockClock::now(); }};
+
+  EXPECT_EQ(telemetry.getNumberOfCommitRetries(), 0);
+  EXPECT_EQ(
+      telemetryDurationToMilliseconds(telemetry.getCommitRetriesTime()), 0);
+
+  telemetry.setCommitRetries(2, std::chrono::milliseconds(150));
+
+  EXPECT_EQ(telemetry.getNumberOfCommitRetries(), 2);
+  EXPECT_EQ(
+      telemetryDurationToMilliseconds(telemetry.getCommitRetriesTime()), 150);
+}
+
+TEST(TransactionTelemetryTest, commitHooks) {
+  auto telemetry = TransactionTelemetry{[]() { return MockClock::now(); }};
+
+  EXPECT_EQ(telemetry.getNumberOfCommitHooks(), 0);
+  EXPECT_EQ(telemetry.getSlowestCommitHookName(), nullptr);
+
+  telemetry.didRunCommitHook("A", std::chrono::milliseconds(10));
+  telemetry.didRunCommitHook("B", std::chrono::milliseconds(30));
+  telemetry.didRunCommitHook("C", std::chrono::milliseconds(20));
+
+  EXPECT_EQ(telemetry.getNumberOfCommitHooks(), 3);
+  EXPECT_EQ(
+      telemetryDurationToMilliseconds(telemetry.getCommitHooksTime()), 60);
+  EXPECT_STREQ(telemetry.getSlowestCommitHookName(), "B");
+  EXPECT_EQ(
+      telemetryDurationToMilliseconds(telemetry.getSlowestCommitHookTime()),
+      30);
+}
+
 TEST(TransactionTelemetryTest, abnormalUseCases) {
   // Calling `did` before `will` should crash.
   EXPECT_DEATH_IF_SUPPORTED(
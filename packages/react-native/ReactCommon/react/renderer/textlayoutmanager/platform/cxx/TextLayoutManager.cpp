@@ -7,25 +7,573 @@
 
 #include "TextLayoutManager.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <react/renderer/graphics/rounding.h>
+#include <react/renderer/telemetry/TransactionTelemetry.h>
+
 namespace facebook::react {
 
-void* TextLayoutManager::getNativeTextLayoutManager() const {
-  return (void*)this;
+namespace {
+
+/*
+ * The font-metrics model. All values are fractions of the font size.
+ */
+constexpr Float kAscenderRatio = 0.8f;
+constexpr Float kDescenderRatio = 0.2f;
+constexpr Float kCapHeightRatio = 0.7f;
+constexpr Float kXHeightRatio = 0.5f;
+constexpr Float kLineHeightRatio = 1.2f;
+constexpr Float kBoldAdvanceRatio = 1.05f;
+constexpr Float kEllipsisAdvanceRatio = 1.0f;
+constexpr Float kDefaultFontSize = 14;
+
+/*
+ * Accumulated floating point errors smaller than this never cause a line
+ * break and are not rounded up to the next pixel.
+ */
+constexpr Float kLayoutEpsilon = 0.01f;
+
+constexpr char kEllipsis[] = "\xE2\x80\xA6"; // U+2026
+
+struct FontMetrics {
+  Float fontSize{kDefaultFontSize};
+  Float letterSpacing{0};
+  Float lineHeight{kDefaultFontSize * kLineHeightRatio};
+  Float ascender{kDefaultFontSize * kAscenderRatio};
+  Float descender{kDefaultFontSize * kDescenderRatio};
+  bool isBold{false};
+};
+
+FontMetrics fontMetricsFromTextAttributes(
+    const TextAttributes& textAttributes) {
+  auto scale = textAttributes.allowFontScaling.value_or(true) &&
+          !std::isnan(textAttributes.fontSizeMultiplier)
+      ? textAttributes.fontSizeMultiplier
+      : Float{1};
+
+  auto fontMetrics = FontMetrics{};
+  fontMetrics.fontSize = (std::isnan(textAttributes.fontSize)
+                              ? kDefaultFontSize
+                              : textAttributes.fontSize) *
+      scale;
+  fontMetrics.letterSpacing = std::isnan(textAttributes.letterSpacing)
+      ? 0
+      : textAttributes.letterSpacing * scale;
+  fontMetrics.lineHeight = std::isnan(textAttributes.lineHeight)
+      ? fontMetrics.fontSize * kLineHeightRatio
+      : textAttributes.lineHeight * scale;
+  fontMetrics.ascender = fontMetrics.fontSize * kAscenderRatio;
+  fontMetrics.descender = fontMetrics.fontSize * kDescenderRatio;
+  fontMetrics.isBold = textAttributes.fontWeight.has_value() &&
+      static_cast<int>(*textAttributes.fontWeight) >=
+          static_cast<int>(FontWeight::Semibold);
+  return fontMetrics;
 }
 
-TextMeasurement TextLayoutManager::measure(
-    const AttributedStringBox& attributedStringBox,
-    const ParagraphAttributes& /*paragraphAttributes*/,
-    const TextLayoutContext& /*layoutContext*/,
-    const LayoutConstraints& /*layoutConstraints*/) const {
+/*
+ * CJK ideographs, Hangul, fullwidth forms and emoji are full-width glyphs
+ * and (like in real text engines) lines can be broken around each of them.
+ */
+bool isWideCodePoint(uint32_t codePoint) {
+  return (codePoint >= 0x1100 && codePoint <= 0x115F) ||
+      (codePoint >= 0x2E80 && codePoint <= 0xA4CF) ||
+      (codePoint >= 0xAC00 && codePoint <= 0xD7A3) ||
+      (codePoint >= 0xF900 && codePoint <= 0xFAFF) ||
+      (codePoint >= 0xFF00 && codePoint <= 0xFF60) ||
+      (codePoint >= 0x1F300 && codePoint <= 0x1FAFF) ||
+      (codePoint >= 0x20000 && codePoint <= 0x3FFFD);
+}
+
+/*
+ * Combining marks, variation selectors and joiners don't form glyphs on their
+ * own: they are rendered as a part of the preceding cluster.
+ */
+bool isExtendingCodePoint(uint32_t codePoint) {
+  return (codePoint >= 0x0300 && codePoint <= 0x036F) ||
+      (codePoint >= 0x1AB0 && codePoint <= 0x1AFF) ||
+      (codePoint >= 0x20D0 && codePoint <= 0x20FF) ||
+      (codePoint >= 0xFE00 && codePoint <= 0xFE0F) ||
+      (codePoint >= 0xFE20 && codePoint <= 0xFE2F) ||
+      (codePoint >= 0x1F3FB && codePoint <= 0x1F3FF) ||
+      (codePoint >= 0xE0100 && codePoint <= 0xE01EF) || codePoint == 0x200D;
+}
+
+Float advanceRatioForCodePoint(uint32_t codePoint) {
+  if (codePoint == ' ' || codePoint == '\t') {
+    return 0.28f;
+  }
+
+  if (codePoint < 0x80) {
+    switch (codePoint) {
+      case 'f':
+      case 'i':
+      case 'j':
+      case 'l':
+      case 't':
+      case 'I':
+      case '.':
+      case ',':
+      case ':':
+      case ';':
+      case '!':
+      case '\'':
+      case '|':
+        return 0.3f;
+      case 'm':
+      case 'w':
+      case 'M':
+      case 'W':
+      case '@':
+        return 0.85f;
+      default:
+        break;
+    }
+
+    if (codePoint >= 'A' && codePoint <= 'Z') {
+      return 0.65f;
+    }
+    if (codePoint >= '0' && codePoint <= '9') {
+      return 0.55f;
+    }
+    return 0.5f;
+  }
+
+  return isWideCodePoint(codePoint) ? 1.0f : 0.55f;
+}
+
+/*
+ * Decodes a code point starting at `index` and returns the length of its
+ * UTF-8 sequence. Malformed sequences decode as U+FFFD one byte at a time.
+ */
+size_t
+decodeUtf8(const std::string& string, size_t index, uint32_t& codePoint) {
+  auto byte = static_cast<uint8_t>(string[index]);
+  size_t length;
+  if (byte < 0x80) {
+    codePoint = byte;
+    return 1;
+  } else if ((byte & 0xE0) == 0xC0) {
+    codePoint = byte & 0x1F;
+    length = 2;
+  } else if ((byte & 0xF0) == 0xE0) {
+    codePoint = byte & 0x0F;
+    length = 3;
+  } else if ((byte & 0xF8) == 0xF0) {
+    codePoint = byte & 0x07;
+    length = 4;
+  } else {
+    codePoint = 0xFFFD;
+    return 1;
+  }
+
+  if (index + length > string.size()) {
+    codePoint = 0xFFFD;
+    return 1;
+  }
+
+  for (size_t i = 1; i < length; i++) {
+    auto continuation = static_cast<uint8_t>(string[index + i]);
+    if ((continuation & 0xC0) != 0x80) {
+      codePoint = 0xFFFD;
+      return 1;
+    }
+    codePoint = (codePoint << 6) | (continuation & 0x3F);
+  }
+
+  return length;
+}
+
+/*
+ * The smallest unit of text layout: a code point with all code points
+ * extending it, or an attachment.
+ */
+struct Cluster {
+  size_t fragmentIndex;
+  size_t begin;
+  size_t end;
+  Float advance;
+  bool isWhitespace;
+  bool isNewline;
+  bool canBreakAfter;
+  bool isAttachment;
+};
+
+struct Line {
+  std::string text;
+  Rect frame;
+  Float baseline;
+  Float ascender;
+  Float descender;
+  Float capHeight;
+  Float xHeight;
+};
+
+struct TextLayout {
+  std::vector<Line> lines;
+  Size size;
   TextMeasurement::Attachments attachments;
-  for (const auto& fragment : attributedStringBox.getValue().getFragments()) {
+};
+
+std::vector<Cluster> segmentAttributedString(
+    const AttributedString& attributedString,
+    const std::vector<FontMetrics>& fontMetrics) {
+  const auto& fragments = attributedString.getFragments();
+  auto clusters = std::vector<Cluster>{};
+
+  for (size_t fragmentIndex = 0; fragmentIndex < fragments.size();
+       fragmentIndex++) {
+    const auto& fragment = fragments[fragmentIndex];
+    const auto& metrics = fontMetrics[fragmentIndex];
+
     if (fragment.isAttachment()) {
-      attachments.push_back(
-          TextMeasurement::Attachment{{{0, 0}, {0, 0}}, false});
+      clusters.push_back(Cluster{
+          fragmentIndex,
+          0,
+          fragment.string.size(),
+          fragment.parentShadowView.layoutMetrics.frame.size.width,
+          false,
+          false,
+          true,
+          true});
+      continue;
+    }
+
+    const auto& string = fragment.string;
+    auto boldRatio = metrics.isBold ? kBoldAdvanceRatio : Float{1};
+    size_t index = 0;
+    while (index < string.size()) {
+      uint32_t codePoint;
+      auto length = decodeUtf8(string, index, codePoint);
+
+      if (isExtendingCodePoint(codePoint) && !clusters.empty() &&
+          clusters.back().fragmentIndex == fragmentIndex &&
+          !clusters.back().isNewline) {
+        auto& cluster = clusters.back();
+        cluster.end = index + length;
+        if (codePoint == 0x200D && cluster.end < string.size()) {
+          // A joiner glues the next code point to the cluster too.
+          uint32_t joinedCodePoint;
+          cluster.end += decodeUtf8(string, cluster.end, joinedCodePoint);
+        }
+        index = cluster.end;
+        continue;
+      }
+
+      auto isNewline = codePoint == '\n';
+      auto isWhitespace = isNewline || codePoint == ' ' || codePoint == '\t';
+      auto advance = Float{0};
+      if (!isNewline) {
+        advance = advanceRatioForCodePoint(codePoint) * metrics.fontSize *
+                boldRatio +
+            metrics.letterSpacing;
+      }
+
+      if (isWideCodePoint(codePoint) && !clusters.empty()) {
+        // Lines can be broken before a full-width glyph.
+        clusters.back().canBreakAfter = true;
+      }
+
+      clusters.push_back(Cluster{
+          fragmentIndex,
+          index,
+          index + length,
+          advance,
+          isWhitespace,
+          isNewline,
+          isWhitespace || isWideCodePoint(codePoint) || codePoint == '-',
+          false});
+      index += length;
+    }
+  }
+
+  return clusters;
+}
+
+/*
+ * Greedily breaks `clusters` into lines no wider than `maximumWidth`.
+ * Returns pairs of indices of the first and past-the-last cluster of lines.
+ */
+std::vector<std::pair<size_t, size_t>> breakLines(
+    const std::vector<Cluster>& clusters,
+    Float maximumWidth) {
+  auto lines = std::vector<std::pair<size_t, size_t>>{};
+  auto lineBegin = size_t{0};
+  auto lineWidth = Float{0};
+  auto lastBreak = size_t{0};
+
+  for (size_t index = 0; index < clusters.size(); index++) {
+    const auto& cluster = clusters[index];
+
+    if (cluster.isNewline) {
+      lines.emplace_back(lineBegin, index + 1);
+      lineBegin = index + 1;
+      lastBreak = lineBegin;
+      lineWidth = 0;
+      continue;
+    }
+
+    // Whitespace hangs over the edge of a line and never causes a break.
+    if (!cluster.isWhitespace && index > lineBegin &&
+        lineWidth + cluster.advance > maximumWidth + kLayoutEpsilon) {
+      // Breaking at the last opportunity or, if a single word doesn't fit,
+      // in the middle of the word.
+      auto lineEnd = lastBreak > lineBegin ? lastBreak : index;
+      lines.emplace_back(lineBegin, lineEnd);
+      lineBegin = lineEnd;
+      lastBreak = lineBegin;
+
+      lineWidth = 0;
+      for (auto i = lineBegin; i < index; i++) {
+        lineWidth += clusters[i].advance;
+      }
+    }
+
+    lineWidth += cluster.advance;
+    if (cluster.canBreakAfter) {
+      lastBreak = index + 1;
+    }
+  }
+
+  if (lineBegin < clusters.size() ||
+      (!clusters.empty() && clusters.back().isNewline)) {
+    lines.emplace_back(lineBegin, clusters.size());
+  }
+
+  return lines;
+}
+
+Float measureClusters(
+    const std::vector<Cluster>& clusters,
+    size_t begin,
+    size_t end) {
+  // Trailing whitespace doesn't contribute to the width of a line.
+  while (end > begin && clusters[end - 1].isWhitespace) {
+    end--;
+  }
+
+  auto width = Float{0};
+  for (auto index = begin; index < end; index++) {
+    width += clusters[index].advance;
+  }
+  return width;
+}
+
+TextLayout layoutAttributedString(
+    const AttributedString& attributedString,
+    const ParagraphAttributes& paragraphAttributes,
+    Float maximumWidth,
+    Float containerWidth) {
+  const auto& fragments = attributedString.getFragments();
+  auto baseFontMetrics =
+      fontMetricsFromTextAttributes(attributedString.getBaseTextAttributes());
+  auto fontMetrics = std::vector<FontMetrics>{};
+  fontMetrics.reserve(fragments.size());
+  for (const auto& fragment : fragments) {
+    fontMetrics.push_back(
+        fontMetricsFromTextAttributes(fragment.textAttributes));
+  }
+
+  auto clusters = segmentAttributedString(attributedString, fontMetrics);
+  auto lineRanges = breakLines(clusters, maximumWidth);
+
+  auto isTruncated = paragraphAttributes.maximumNumberOfLines > 0 &&
+      lineRanges.size() >
+          static_cast<size_t>(paragraphAttributes.maximumNumberOfLines);
+  if (isTruncated) {
+    lineRanges.resize(paragraphAttributes.maximumNumberOfLines);
+  }
+
+  auto layout = TextLayout{};
+  layout.lines.reserve(lineRanges.size());
+
+  // Attachment frames are relative to their lines until alignment is known.
+  auto attachmentFrames = std::vector<std::pair<size_t, Rect>>{};
+
+  for (size_t lineIndex = 0; lineIndex < lineRanges.size(); lineIndex++) {
+    auto [begin, end] = lineRanges[lineIndex];
+    auto width = measureClusters(clusters, begin, end);
+    auto text = std::string{};
+
+    auto isLastLine = lineIndex + 1 == lineRanges.size();
+    if (isLastLine && isTruncated &&
+        paragraphAttributes.ellipsizeMode != EllipsizeMode::Clip) {
+      // The measured width of the line is the same for every ellipsize mode,
+      // so all of them are laid out as `Tail`.
+      const auto& metrics = end > begin
+          ? fontMetrics[clusters[end - 1].fragmentIndex]
+          : baseFontMetrics;
+      auto ellipsisAdvance = metrics.fontSize * kEllipsisAdvanceRatio;
+      while (end > begin &&
+             width + ellipsisAdvance > maximumWidth + kLayoutEpsilon) {
+        end--;
+        width = measureClusters(clusters, begin, end);
+      }
+      while (end > begin && clusters[end - 1].isWhitespace) {
+        end--;
+      }
+      width += ellipsisAdvance;
+    }
+
+    auto ascender = Float{0};
+    auto descender = Float{0};
+    auto lineHeight = Float{0};
+    auto fontSize = Float{0};
+    auto hasAttachments = false;
+    auto x = Float{0};
+    for (auto index = begin; index < end; index++) {
+      const auto& cluster = clusters[index];
+      const auto& fragment = fragments[cluster.fragmentIndex];
+      if (cluster.isAttachment) {
+        auto attachmentHeight =
+            fragment.parentShadowView.layoutMetrics.frame.size.height;
+        ascender = std::max(ascender, attachmentHeight);
+        hasAttachments = true;
+        attachmentFrames.emplace_back(
+            lineIndex,
+            Rect{{x, -attachmentHeight}, {cluster.advance, attachmentHeight}});
+      } else {
+        const auto& metrics = fontMetrics[cluster.fragmentIndex];
+        ascender = std::max(ascender, metrics.ascender);
+        descender = std::max(descender, metrics.descender);
+        lineHeight = std::max(lineHeight, metrics.lineHeight);
+        fontSize = std::max(fontSize, metrics.fontSize);
+        if (!cluster.isNewline) {
+          text.append(
+              fragment.string, cluster.begin, cluster.end - cluster.begin);
+        }
+      }
+      x += cluster.advance;
+    }
+
+    if (fontSize == 0) {
+      // Empty lines and lines consisting only of attachments still have
+      // the height of the base font.
+      const auto& metrics = end > begin
+          ? fontMetrics[clusters[begin].fragmentIndex]
+          : baseFontMetrics;
+      ascender = std::max(ascender, metrics.ascender);
+      descender = std::max(descender, metrics.descender);
+      lineHeight = std::max(lineHeight, metrics.lineHeight);
+      fontSize = metrics.fontSize;
+    }
+
+    if (hasAttachments) {
+      // Attachments sit on the baseline and are never clipped by the line.
+      lineHeight = std::max(lineHeight, ascender + descender);
+    }
+
+    if (isLastLine && isTruncated &&
+        paragraphAttributes.ellipsizeMode != EllipsizeMode::Clip) {
+      text += kEllipsis;
+    }
+
+    // Extra leading (or lack of it) is split evenly above and below the glyphs.
+    auto baseline = (lineHeight - (ascender + descender)) / 2 + ascender;
+
+    layout.lines.push_back(Line{
+        std::move(text),
+        Rect{{0, layout.size.height}, {width, lineHeight}},
+        baseline,
+        ascender,
+        descender,
+        fontSize * kCapHeightRatio,
+        fontSize * kXHeightRatio});
+
+    layout.size.width = std::max(layout.size.width, width);
+    layout.size.height += lineHeight;
+  }
+
+  if (std::isnan(containerWidth) || std::isinf(containerWidth)) {
+    containerWidth = layout.size.width;
+  }
+
+  auto alignment =
+      attributedString.getBaseTextAttributes().alignment.value_or(
+          TextAlignment::Natural);
+  for (auto& line : layout.lines) {
+    if (alignment == TextAlignment::Center) {
+      line.frame.origin.x = (containerWidth - line.frame.size.width) / 2;
+    } else if (alignment == TextAlignment::Right) {
+      line.frame.origin.x = containerWidth - line.frame.size.width;
+    }
+  }
+
+  auto visibleAttachmentFrame = attachmentFrames.begin();
+  for (const auto& cluster : clusters) {
+    if (!cluster.isAttachment) {
+      continue;
+    }
+
+    if (visibleAttachmentFrame == attachmentFrames.end()) {
+      // The attachment is in a truncated line.
+      layout.attachments.push_back(
+          TextMeasurement::Attachment{{{0, 0}, {0, 0}}, true});
+      continue;
     }
+
+    auto [lineIndex, frame] = *visibleAttachmentFrame++;
+    const auto& line = layout.lines[lineIndex];
+    frame.origin.x += line.frame.origin.x;
+    frame.origin.y += line.frame.origin.y + line.baseline;
+    layout.attachments.push_back(TextMeasurement::Attachment{frame, false});
   }
-  return TextMeasurement{{0, 0}, attachments};
+
+  return layout;
+}
+
+} // namespace
+
+TextLayoutManager::TextLayoutManager(
+    const ContextContainer::Shared& /*contextContainer*/)
+    : textMeasureCache_(kSimpleThreadSafeCacheSizeCap),
+      lineMeasureCache_(kSimpleThreadSafeCacheSizeCap) {}
+
+void* TextLayoutManager::getNativeTextLayoutManager() const {
+  return (void*)this;
+}
+
+TextMeasurement TextLayoutManager::measure(
+    const AttributedStringBox& attributedStringBox,
+    const ParagraphAttributes& paragraphAttributes,
+    const TextLayoutContext& layoutContext,
+    const LayoutConstraints& layoutConstraints) const {
+  const auto& attributedString = attributedStringBox.getValue();
+
+  auto measurement = textMeasureCache_.get(
+      {attributedString, paragraphAttributes, layoutConstraints},
+      [&](const TextMeasureCacheKey& /*key*/) {
+        auto telemetry = TransactionTelemetry::threadLocalTelemetry();
+        if (telemetry != nullptr) {
+          telemetry->willMeasureText();
+        }
+
+        auto layout = layoutAttributedString(
+            attributedString,
+            paragraphAttributes,
+            layoutConstraints.maximumSize.width,
+            std::numeric_limits<Float>::quiet_NaN());
+
+        if (telemetry != nullptr) {
+          telemetry->didMeasureText();
+        }
+
+        return TextMeasurement{layout.size, std::move(layout.attachments)};
+      });
+
+  // Rounding up to the pixel grid guarantees that laying out the text in the
+  // measured (and then rounded by Yoga) size produces the same lines.
+  auto size = Size{
+      measurement.size.width - kLayoutEpsilon,
+      measurement.size.height - kLayoutEpsilon};
+  measurement.size = layoutConstraints.clamp(
+      roundToPixel<&std::ceil>(size, layoutContext.pointScaleFactor));
+  return measurement;
 }
 
 TextMeasurement TextLayoutManager::measureCachedSpannableById(
@@ -36,17 +584,47 @@ TextMeasurement TextLayoutManager::measureCachedSpannableById(
 }
 
 LinesMeasurements TextLayoutManager::measureLines(
-    const AttributedStringBox& /*attributedStringBox*/,
-    const ParagraphAttributes& /*paragraphAttributes*/,
-    const Size& /*size*/) const {
-  return {};
-};
+    const AttributedStringBox& attributedStringBox,
+    const ParagraphAttributes& paragraphAttributes,
+    const Size& size) const {
+  const auto& attributedString = attributedStringBox.getValue();
+
+  return lineMeasureCache_.get(
+      {attributedString, paragraphAttributes, size},
+      [&](const LineMeasureCacheKey& /*key*/) {
+        auto layout = layoutAttributedString(
+            attributedString, paragraphAttributes, size.width, size.width);
+
+        auto lineMeasurements = LinesMeasurements{};
+        lineMeasurements.reserve(layout.lines.size());
+        for (auto& line : layout.lines) {
+          lineMeasurements.emplace_back(
+              std::move(line.text),
+              line.frame,
+              line.descender,
+              line.capHeight,
+              line.ascender,
+              line.xHeight);
+        }
+        return lineMeasurements;
+      });
+}
 
 Float TextLayoutManager::baseline(
-    const AttributedStringBox& /*attributedStringBox*/,
-    const ParagraphAttributes& /*paragraphAttributes*/,
-    const Size& /*size*/) const {
-  return 0;
+    const AttributedStringBox& attributedStringBox,
+    const ParagraphAttributes& paragraphAttributes,
+    const Size& size) const {
+  auto layout = layoutAttributedString(
+      attributedStringBox.getValue(),
+      paragraphAttributes,
+      size.width,
+      size.width);
+
+  if (layout.lines.empty()) {
+    return 0;
+  }
+
+  return layout.lines.front().frame.origin.y + layout.lines.front().baseline;
 }
 
 } // namespace facebook::react
@@ -24,16 +24,20 @@ class TextLayoutManager;
 using SharedTextLayoutManager = std::shared_ptr<const TextLayoutManager>;
 
 /*
- * Cross platform facade for Android-specific TextLayoutManager.
+ * Headless TextLayoutManager for the cxx platform.
+ * Lays text out with a deterministic built-in font-metrics model (advances,
+ * ascenders and descenders are fixed fractions of the font size) and greedy
+ * line breaking, so measurements are stable across machines and can be used
+ * in tests and benchmarks.
  */
 class TextLayoutManager {
  public:
-  TextLayoutManager(const ContextContainer::Shared& contextContainer) {}
+  TextLayoutManager(const ContextContainer::Shared& contextContainer);
 
   virtual ~TextLayoutManager() = default;
 
   /*
-   * Measures `attributedStringBox` using native text rendering infrastructure.
+   * Measures `attributedStringBox` using the built-in font-metrics model.
    */
   virtual TextMeasurement measure(
       const AttributedStringBox& attributedStringBox,
@@ -51,8 +55,8 @@ class TextLayoutManager {
       const LayoutConstraints& layoutConstraints) const;
 
   /*
-   * Measures lines of `attributedString` using native text rendering
-   * infrastructure.
+   * Measures lines of `attributedString` using the built-in font-metrics
+   * model.
    */
   virtual LinesMeasurements measureLines(
       const AttributedStringBox& attributedStringBox,
@@ -60,8 +64,7 @@ class TextLayoutManager {
       const Size& size) const;
 
   /*
-   * Calculates baseline of `attributedString` using native text rendering
-   * infrastructure.
+   * Calculates baseline of the first line of `attributedString`.
    */
   virtual Float baseline(
       const AttributedStringBox& attributedStringBox,
@@ -73,6 +76,10 @@ class TextLayoutManager {
    * Is used on a native views layer to delegate text rendering to the manager.
    */
   void* getNativeTextLayoutManager() const;
+
+ private:
+  TextMeasureCache textMeasureCache_;
+  LineMeasureCache lineMeasureCache_;
 };
 
 } // namespace facebook::react
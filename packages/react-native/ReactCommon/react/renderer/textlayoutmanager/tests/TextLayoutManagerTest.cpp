@@ -5,6 +5,7 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <limits>
 #include <memory>
 
 #include <gtest/gtest.h>
@@ -13,6 +14,101 @@
 
 using namespace facebook::react;
 
+namespace {
+
+AttributedString attributedStringWithText(const std::string& text) {
+  auto textAttributes = TextAttributes::defaultTextAttributes();
+  textAttributes.fontSize = 10;
+
+  auto fragment = AttributedString::Fragment{};
+  fragment.string = text;
+  fragment.textAttributes = textAttributes;
+
+  auto attributedString = AttributedString{};
+  attributedString.appendFragment(std::move(fragment));
+  attributedString.setBaseTextAttributes(textAttributes);
+  return attributedString;
+}
+
+TextMeasurement measure(
+    const AttributedString& attributedString,
+    const ParagraphAttributes& paragraphAttributes,
+    Float maximumWidth) {
+  auto textLayoutManager =
+      TextLayoutManager{std::make_shared<const ContextContainer>()};
+  return textLayoutManager.measure(
+      AttributedStringBox{attributedString},
+      paragraphAttributes,
+      {},
+      {{0, 0},
+       {maximumWidth, std::numeric_limits<Float>::infinity()},
+       LayoutDirection::LeftToRight});
+}
+
+} // namespace
+
 TEST(TextLayoutManagerTest, testSomething) {
   // TODO:
 }
+
+TEST(TextLayoutManagerTest, measuresSingleLine) {
+  auto measurement = measure(
+      attributedStringWithText("Hello"),
+      {},
+      std::numeric_limits<Float>::infinity());
+
+  EXPECT_EQ(measurement.size.width, 23);
+  EXPECT_EQ(measurement.size.height, 12);
+}
+
+TEST(TextLayoutManagerTest, breaksLinesAtWhitespace) {
+  auto measurement = measure(attributedStringWithText("Hello world"), {}, 30);
+
+  EXPECT_EQ(measurement.size.width, 27);
+  EXPECT_EQ(measurement.size.height, 24);
+}
+
+TEST(TextLayoutManagerTest, breaksWordsWhichDontFit) {
+  auto measurement =
+      measure(attributedStringWithText("Supercalifragilistic"), {}, 40);
+
+  EXPECT_LE(measurement.size.width, 40);
+  EXPECT_EQ(measurement.size.height, 36);
+}
+
+TEST(TextLayoutManagerTest, honorsMaximumNumberOfLines) {
+  auto paragraphAttributes = ParagraphAttributes{};
+  paragraphAttributes.maximumNumberOfLines = 1;
+
+  auto measurement = measure(
+      attributedStringWithText("Hello world"), paragraphAttributes, 30);
+
+  EXPECT_EQ(measurement.size.height, 12);
+}
+
+TEST(TextLayoutManagerTest, measuresLines) {
+  auto textLayoutManager =
+      TextLayoutManager{std::make_shared<const ContextContainer>()};
+  auto paragraphAttributes = ParagraphAttributes{};
+  paragraphAttributes.maximumNumberOfLines = 2;
+  paragraphAttributes.ellipsizeMode = EllipsizeMode::Tail;
+
+  auto lines = textLayoutManager.measureLines(
+      AttributedStringBox{attributedStringWithText("Hello world and more")},
+      paragraphAttributes,
+      {30, 100});
+
+  ASSERT_EQ(lines.size(), 2);
+  EXPECT_EQ(lines[0].text, "Hello ");
+  EXPECT_EQ(lines[0].frame.origin.y, 0);
+  EXPECT_EQ(lines[1].text, "wor\u2026");
+  EXPECT_FLOAT_EQ(lines[1].frame.origin.y, 12);
+  EXPECT_FLOAT_EQ(lines[1].ascender, 8);
+  EXPECT_FLOAT_EQ(lines[1].descender, 2);
+
+  auto baseline = textLayoutManager.baseline(
+      AttributedStringBox{attributedStringWithText("Hello")},
+      {},
+      {30, 100});
+  EXPECT_FLOAT_EQ(baseline, 9);
+}
@@ -14,6 +14,7 @@
 #include <react/renderer/core/DynamicPropsUtilities.h>
 #include <react/renderer/core/PropsParserContext.h>
 #include <react/renderer/core/ShadowNodeFragment.h>
+#include <react/renderer/telemetry/TransactionTelemetry.h>
 #include <react/renderer/uimanager/SurfaceRegistryBinding.h>
 #include <react/renderer/uimanager/UIManagerBinding.h>
 #include <react/renderer/uimanager/UIManagerCommitHook.h>
@@ -21,6 +22,9 @@
 
 #include <glog/logging.h>
 
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 namespace {
@@ -353,49 +357,137 @@ LayoutMetrics UIManager::getRelativeLayoutMetrics(
       shadowNode.getFamily(), *layoutableAncestorShadowNode, policy);
 }
 
+namespace {
+
+/*
+ * Clones the tree of `rootShadowNode` applying `stateUpdate` to the node of
+ * the given family. Returns `nullptr` if the update should be discarded.
+ */
+ShadowNode::Unshared cloneTreeWithStateUpdate(
+    const ShadowNode& rootShadowNode,
+    const StateUpdate& stateUpdate) {
+  auto& callback = stateUpdate.callback;
+  auto& family = stateUpdate.family;
+  auto& componentDescriptor = family->getComponentDescriptor();
+
+  auto isValid = true;
+
+  auto rootNode = rootShadowNode.cloneTree(
+      *family, [&](const ShadowNode& oldShadowNode) {
+        auto newData = callback(oldShadowNode.getState()->getDataPointer());
+
+        if (!newData) {
+          isValid = false;
+          // Just return something, we will discard it anyway.
+          return oldShadowNode.clone({});
+        }
+
+        auto newState = componentDescriptor.createState(*family, newData);
+
+        return oldShadowNode.clone(
+            {.props = ShadowNodeFragment::propsPlaceholder(),
+             .children = ShadowNodeFragment::childrenPlaceholder(),
+             .state = newState});
+      });
+
+  return isValid ? rootNode : nullptr;
+}
+
+} // namespace
+
 void UIManager::updateState(const StateUpdate& stateUpdate) const {
   SystraceSection s(
       "UIManager::updateState",
       "componentName",
       stateUpdate.family->getComponentName());
-  auto& callback = stateUpdate.callback;
   auto& family = stateUpdate.family;
-  auto& componentDescriptor = family->getComponentDescriptor();
 
   shadowTreeRegistry_.visit(
       family->getSurfaceId(), [&](const ShadowTree& shadowTree) {
         shadowTree.commit(
             [&](const RootShadowNode& oldRootShadowNode) {
-              auto isValid = true;
-
-              auto rootNode = oldRootShadowNode.cloneTree(
-                  *family, [&](const ShadowNode& oldShadowNode) {
-                    auto newData =
-                        callback(oldShadowNode.getState()->getDataPointer());
-
-                    if (!newData) {
-                      isValid = false;
-                      // Just return something, we will discard it anyway.
-                      return oldShadowNode.clone({});
-                    }
-
-                    auto newState =
-                        componentDescriptor.createState(*family, newData);
-
-                    return oldShadowNode.clone(
-                        {.props = ShadowNodeFragment::propsPlaceholder(),
-                         .children = ShadowNodeFragment::childrenPlaceholder(),
-                         .state = newState});
-                  });
-
-              return isValid
-                  ? std::static_pointer_cast<RootShadowNode>(rootNode)
-                  : nullptr;
+              return std::static_pointer_cast<RootShadowNode>(
+                  cloneTreeWithStateUpdate(oldRootShadowNode, stateUpdate));
             },
             {/* default commit options */});
       });
 }
 
+void UIManager::updateStates(std::vector<StateUpdate>&& stateUpdates) const {
+  SystraceSection s(
+      "UIManager::updateStates", "count", std::to_string(stateUpdates.size()));
+
+  using StateUpdatesByFamily = std::unordered_map<
+      const ShadowNodeFamily*,
+      std::vector<const StateUpdate*>>;
+
+  // Group updates by surface and family, preserving their relative order.
+  // There are usually very few surfaces involved, so a linear scan is enough.
+  std::vector<std::pair<SurfaceId, StateUpdatesByFamily>> updatesBySurface;
+  for (const auto& stateUpdate : stateUpdates) {
+    auto surfaceId = stateUpdate.family->getSurfaceId();
+    auto it = std::find_if(
+        updatesBySurface.begin(),
+        updatesBySurface.end(),
+        [&](const auto& entry) { return entry.first == surfaceId; });
+    if (it == updatesBySurface.end()) {
+      updatesBySurface.emplace_back(surfaceId, StateUpdatesByFamily{});
+      it = std::prev(updatesBySurface.end());
+    }
+    it->second[stateUpdate.family.get()].push_back(&stateUpdate);
+  }
+
+  for (const auto& [surfaceId, updatesByFamily] : updatesBySurface) {
+    std::unordered_set<const ShadowNodeFamily*> families;
+    families.reserve(updatesByFamily.size());
+    for (const auto& [family, _] : updatesByFamily) {
+      families.insert(family);
+    }
+
+    shadowTreeRegistry_.visit(surfaceId, [&](const ShadowTree& shadowTree) {
+      shadowTree.commit(
+          [&](const RootShadowNode& oldRootShadowNode)
+              -> RootShadowNode::Unshared {
+            auto hasUpdates = false;
+
+            auto rootNode = oldRootShadowNode.cloneMultiple(
+                families,
+                [&](const ShadowNode& oldShadowNode,
+                    const ShadowNodeFragment& fragment) {
+                  const auto& family = oldShadowNode.getFamily();
+                  auto data = oldShadowNode.getState()->getDataPointer();
+                  auto isUpdated = false;
+
+                  // Each callback sees the data produced by the previous one;
+                  // updates whose callback returns `nullptr` are discarded.
+                  for (const auto* stateUpdate : updatesByFamily.at(&family)) {
+                    if (auto newData = stateUpdate->callback(data)) {
+                      data = std::move(newData);
+                      isUpdated = true;
+                    }
+                  }
+
+                  if (!isUpdated) {
+                    return oldShadowNode.clone({.children = fragment.children});
+                  }
+
+                  hasUpdates = true;
+                  return oldShadowNode.clone(
+                      {.props = ShadowNodeFragment::propsPlaceholder(),
+                       .children = fragment.children,
+                       .state = family.getComponentDescriptor().createState(
+                           family, data)});
+                });
+
+            return hasUpdates
+                ? std::static_pointer_cast<RootShadowNode>(rootNode)
+                : nullptr;
+          },
+          {/* default commit options */});
+    });
+  }
+}
+
 void UIManager::dispatchCommand(
     const ShadowNode::Shared& shadowNode,
     const std::string& commandName,
@@ -597,10 +689,46 @@ RootShadowNode::Unshared UIManager::shadowTreeWillCommit(
 
   std::shared_lock lock(commitHookMutex_);
 
+  auto* telemetry = TransactionTelemetry::threadLocalTelemetry();
+  auto runCommitHook = [&](UIManagerCommitHook& commitHook,
+                           const RootShadowNode::Unshared& rootShadowNode) {
+    SystraceSection hookSection(
+        "UIManagerCommitHook::shadowTreeWillCommit",
+        "name",
+        commitHook.getCommitHookName());
+    auto startTime = telemetryTimePointNow();
+    auto resultRootShadowNode = commitHook.shadowTreeWillCommit(
+        shadowTree, oldRootShadowNode, rootShadowNode);
+    if (telemetry != nullptr) {
+      telemetry->didRunCommitHook(
+          commitHook.getCommitHookName(), telemetryTimePointNow() - startTime);
+    }
+    return resultRootShadowNode;
+  };
+
   auto resultRootShadowNode = newRootShadowNode;
   for (auto* commitHook : commitHooks_) {
-    resultRootShadowNode = commitHook->shadowTreeWillCommit(
-        shadowTree, oldRootShadowNode, resultRootShadowNode);
+    if (commitHook->isReadOnly()) {
+      continue;
+    }
+
+    resultRootShadowNode = runCommitHook(*commitHook, resultRootShadowNode);
+    if (!resultRootShadowNode) {
+      // The commit was cancelled, there is nothing to observe.
+      return nullptr;
+    }
+  }
+
+  for (auto* commitHook : commitHooks_) {
+    if (!commitHook->isReadOnly()) {
+      continue;
+    }
+
+    [[maybe_unused]] auto observedRootShadowNode =
+        runCommitHook(*commitHook, resultRootShadowNode);
+    react_native_assert(
+        observedRootShadowNode == resultRootShadowNode &&
+        "Read-only commit hooks must not alter the committed tree.");
   }
 
   return resultRootShadowNode;
@@ -173,6 +173,15 @@ class UIManager final : public ShadowTreeDelegate {
    */
   void updateState(const StateUpdate& stateUpdate) const;
 
+  /*
+   * Same as `updateState`, but applies all the updates targeting the same
+   * surface in a single commit (instead of one commit per update). Updates
+   * are applied in order; an update whose callback returns `nullptr` (or
+   * whose node is no longer in the tree) is skipped without affecting the
+   * others.
+   */
+  void updateStates(std::vector<StateUpdate>&& stateUpdates) const;
+
   void dispatchCommand(
       const ShadowNode::Shared& shadowNode,
       const std::string& commandName,
@@ -36,6 +36,25 @@ class UIManagerCommitHook {
       const RootShadowNode::Shared& oldRootShadowNode,
       const RootShadowNode::Unshared& newRootShadowNode) noexcept = 0;
 
+  /*
+   * Read-only commit hooks only observe commits and must return
+   * `newRootShadowNode` from `shadowTreeWillCommit` as is.
+   * They are called after all other hooks (so they observe the tree which is
+   * actually going to be committed) and are skipped for cancelled commits.
+   */
+  virtual bool isReadOnly() const noexcept {
+    return false;
+  }
+
+  /*
+   * A name which attributes the time spent in the hook in `Systrace` and
+   * `TransactionTelemetry`. Must be a string literal or otherwise outlive the
+   * hook.
+   */
+  virtual const char* getCommitHookName() const noexcept {
+    return "UIManagerCommitHook";
+  }
+
   virtual ~UIManagerCommitHook() noexcept = default;
 };
 
@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <react/renderer/components/scrollview/ScrollViewShadowNode.h>
+#include <react/renderer/element/ComponentBuilder.h>
+#include <react/renderer/element/Element.h>
+#include <react/renderer/element/testUtils.h>
+#include <react/renderer/mounting/ShadowTree.h>
+#include <react/renderer/uimanager/UIManager.h>
+#include <react/renderer/uimanager/UIManagerCommitHook.h>
+
+namespace facebook::react {
+
+namespace {
+
+const ShadowNode* findDescendantNode(
+    const ShadowNode& shadowNode,
+    const ShadowNodeFamily& family) {
+  if (&shadowNode.getFamily() == &family) {
+    return &shadowNode;
+  }
+
+  for (const auto& childNode : shadowNode.getChildren()) {
+    if (auto descendant = findDescendantNode(*childNode, family)) {
+      return descendant;
+    }
+  }
+
+  return nullptr;
+}
+
+class CommitCountingHook : public UIManagerCommitHook {
+ public:
+  void commitHookWasRegistered(const UIManager& /*uiManager*/) noexcept
+      override {}
+  void commitHookWasUnregistered(const UIManager& /*uiManager*/) noexcept
+      override {}
+
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      const ShadowTree& shadowTree,
+      const RootShadowNode::Shared& /*oldRootShadowNode*/,
+      const RootShadowNode::Unshared& newRootShadowNode) noexcept override {
+    surfaceIds.push_back(shadowTree.getSurfaceId());
+    return newRootShadowNode;
+  }
+
+  std::vector<SurfaceId> surfaceIds;
+};
+
+// Records the order in which hooks are called and the trees they see.
+class RecordingCommitHook : public UIManagerCommitHook {
+ public:
+  enum class Behavior { Observe, Mutate, Cancel };
+
+  RecordingCommitHook(
+      const char* name,
+      Behavior behavior,
+      std::vector<std::string>& calls)
+      : name_(name), behavior_(behavior), calls_(calls) {}
+
+  void commitHookWasRegistered(const UIManager& /*uiManager*/) noexcept
+      override {}
+  void commitHookWasUnregistered(const UIManager& /*uiManager*/) noexcept
+      override {}
+
+  RootShadowNode::Unshared shadowTreeWillCommit(
+      const ShadowTree& /*shadowTree*/,
+      const RootShadowNode::Shared& /*oldRootShadowNode*/,
+      const RootShadowNode::Unshared& newRootShadowNode) noexcept override {
+    calls_.emplace_back(name_);
+    observedRootShadowNode = newRootShadowNode;
+    if (behavior_ == Behavior::Cancel) {
+      return nullptr;
+    }
+    if (behavior_ == Behavior::Mutate) {
+      return std::static_pointer_cast<RootShadowNode>(
+          newRootShadowNode->ShadowNode::clone({}));
+    }
+    return newRootShadowNode;
+  }
+
+  bool isReadOnly() const noexcept override {
+    return behavior_ == Behavior::Observe;
+  }
+
+  const char* getCommitHookName() const noexcept override {
+    return name_;
+  }
+
+  RootShadowNode::Shared observedRootShadowNode;
+
+ private:
+  const char* name_;
+  Behavior behavior_;
+  std::vector<std::string>& calls_;
+};
+
+// The family of `shadowNode`, not owned: the tests keep the nodes alive.
+ShadowNodeFamily::Shared getFamily(const ShadowNode& shadowNode) {
+  return {std::shared_ptr<void>{}, &shadowNode.getFamily()};
+}
+
+// Appends `digit` to the content offset of a scroll view, so the final offset
+// tells in which order updates were applied.
+StateUpdate appendDigit(const ShadowNode& shadowNode, int digit) {
+  return StateUpdate{
+      .family = getFamily(shadowNode),
+      .callback = [digit](const StateData::Shared& data) -> StateData::Shared {
+        const auto& oldState =
+            *std::static_pointer_cast<const ScrollViewState>(data);
+        return std::make_shared<const ScrollViewState>(
+            Point{oldState.contentOffset.x * 10 + digit, 0}, Rect{}, 0);
+      }};
+}
+
+} // namespace
+
+class UIManagerTest : public ::testing::Test {
+ protected:
+  UIManagerTest()
+      : builder_(simpleComponentBuilder()),
+        contextContainer_(std::make_shared<ContextContainer>()),
+        uiManager_(
+            [](std::function<void(jsi::Runtime&)>&& /*callback*/) {},
+            contextContainer_) {}
+
+  // Starts a surface with two scroll views and returns them.
+  std::pair<ShadowNode::Shared, ShadowNode::Shared> startSurface(
+      SurfaceId surfaceId) {
+    auto firstScrollView = std::shared_ptr<ScrollViewShadowNode>{};
+    auto secondScrollView = std::shared_ptr<ScrollViewShadowNode>{};
+
+    // clang-format off
+    auto element =
+        Element<RootShadowNode>()
+          .surfaceId(surfaceId)
+          .children({
+            Element<ScrollViewShadowNode>()
+              .surfaceId(surfaceId)
+              .reference(firstScrollView),
+            Element<ScrollViewShadowNode>()
+              .surfaceId(surfaceId)
+              .reference(secondScrollView)
+          });
+    // clang-format on
+
+    auto rootShadowNode = builder_.build(element);
+    auto shadowTree = std::make_unique<ShadowTree>(
+        surfaceId,
+        LayoutConstraints{},
+        LayoutContext{},
+        uiManager_,
+        *contextContainer_);
+    shadowTree->commit(
+        [&](const RootShadowNode& /*oldRootShadowNode*/) {
+          return std::static_pointer_cast<RootShadowNode>(
+              rootShadowNode->ShadowNode::clone({}));
+        },
+        {});
+    uiManager_.startSurface(
+        std::move(shadowTree),
+        "",
+        folly::dynamic::object(),
+        DisplayMode::Visible);
+
+    return {firstScrollView, secondScrollView};
+  }
+
+  // Commits a clone of the current tree of the surface.
+  void commit(SurfaceId surfaceId) {
+    uiManager_.getShadowTreeRegistry().visit(
+        surfaceId, [](const ShadowTree& shadowTree) {
+          shadowTree.commit(
+              [](const RootShadowNode& oldRootShadowNode) {
+                return std::static_pointer_cast<RootShadowNode>(
+                    oldRootShadowNode.ShadowNode::clone({}));
+              },
+              {});
+        });
+  }
+
+  RootShadowNode::Shared getRootShadowNode(SurfaceId surfaceId) {
+    auto rootShadowNode = RootShadowNode::Shared{};
+    uiManager_.getShadowTreeRegistry().visit(
+        surfaceId, [&](const ShadowTree& shadowTree) {
+          rootShadowNode = shadowTree.getCurrentRevision().rootShadowNode;
+        });
+    return rootShadowNode;
+  }
+
+  Float getContentOffset(const ShadowNode& shadowNode) {
+    auto contentOffset = Float{-1};
+    uiManager_.getShadowTreeRegistry().visit(
+        shadowNode.getSurfaceId(), [&](const ShadowTree& shadowTree) {
+          auto node = findDescendantNode(
+              *shadowTree.getCurrentRevision().rootShadowNode,
+              shadowNode.getFamily());
+          if (node != nullptr) {
+            contentOffset = static_cast<const ScrollViewShadowNode&>(*node)
+                                .getStateData()
+                                .contentOffset.x;
+          }
+        });
+    return contentOffset;
+  }
+
+  ComponentBuilder builder_;
+  ContextContainer::Shared contextContainer_;
+  UIManager uiManager_;
+};
+
+TEST_F(UIManagerTest, updateStatesCommitsOncePerSurface) {
+  auto [firstNode, secondNode] = startSurface(1);
+  auto [otherSurfaceNode, _] = startSurface(2);
+
+  CommitCountingHook commitHook;
+  uiManager_.registerCommitHook(commitHook);
+
+  uiManager_.updateStates(
+      {appendDigit(*firstNode, 1),
+       appendDigit(*otherSurfaceNode, 2),
+       appendDigit(*secondNode, 3),
+       appendDigit(*firstNode, 4)});
+
+  EXPECT_EQ(commitHook.surfaceIds, (std::vector<SurfaceId>{1, 2}));
+  EXPECT_EQ(getContentOffset(*firstNode), 14);
+  EXPECT_EQ(getContentOffset(*secondNode), 3);
+  EXPECT_EQ(getContentOffset(*otherSurfaceNode), 2);
+
+  uiManager_.unregisterCommitHook(commitHook);
+}
+
+TEST_F(UIManagerTest, updateStatesAppliesUpdatesInOrder) {
+  auto [node, _] = startSurface(1);
+
+  uiManager_.updateStates(
+      {appendDigit(*node, 3), appendDigit(*node, 1), appendDigit(*node, 2)});
+
+  EXPECT_EQ(getContentOffset(*node), 312);
+}
+
+TEST_F(UIManagerTest, updateStatesSkipsDiscardedUpdates) {
+  auto [node, _] = startSurface(1);
+
+  auto discardedUpdate = StateUpdate{
+      .family = getFamily(*node),
+      .callback = [](const StateData::Shared& /*data*/) -> StateData::Shared {
+        return nullptr;
+      }};
+
+  uiManager_.updateStates(
+      {appendDigit(*node, 1), discardedUpdate, appendDigit(*node, 2)});
+
+  EXPECT_EQ(getContentOffset(*node), 12);
+}
+
+TEST_F(UIManagerTest, updateStatesSkipsUpdatesOfRemovedNodes) {
+  auto [node, _] = startSurface(1);
+
+  // A node of the same surface which is not part of the committed tree.
+  auto removedNode = std::shared_ptr<ScrollViewShadowNode>{};
+  builder_.build(
+      Element<ScrollViewShadowNode>().surfaceId(1).reference(removedNode));
+
+  uiManager_.updateStates(
+      {appendDigit(*removedNode, 1), appendDigit(*node, 2)});
+
+  EXPECT_EQ(getContentOffset(*node), 2);
+}
+
+TEST_F(UIManagerTest, readOnlyCommitHooksRunAfterMutatingHooks) {
+  startSurface(1);
+
+  using Behavior = RecordingCommitHook::Behavior;
+  auto calls = std::vector<std::string>{};
+  auto observingHook = RecordingCommitHook{"observe", Behavior::Observe, calls};
+  auto mutatingHook = RecordingCommitHook{"mutate", Behavior::Mutate, calls};
+  uiManager_.registerCommitHook(observingHook);
+  uiManager_.registerCommitHook(mutatingHook);
+
+  commit(1);
+
+  EXPECT_EQ(calls, (std::vector<std::string>{"mutate", "observe"}));
+  // The read-only hook observes the tree produced by the mutating hook, which
+  // is the one that gets committed.
+  EXPECT_NE(
+      observingHook.observedRootShadowNode,
+      mutatingHook.observedRootShadowNode);
+  EXPECT_EQ(observingHook.observedRootShadowNode, getRootShadowNode(1));
+
+  uiManager_.unregisterCommitHook(mutatingHook);
+  uiManager_.unregisterCommitHook(observingHook);
+}
+
+TEST_F(UIManagerTest, cancelledCommitsAreNotObserved) {
+  startSurface(1);
+  auto rootShadowNode = getRootShadowNode(1);
+
+  using Behavior = RecordingCommitHook::Behavior;
+  auto calls = std::vector<std::string>{};
+  auto observingHook = RecordingCommitHook{"observe", Behavior::Observe, calls};
+  auto cancellingHook = RecordingCommitHook{"cancel", Behavior::Cancel, calls};
+  auto mutatingHook = RecordingCommitHook{"mutate", Behavior::Mutate, calls};
+  uiManager_.registerCommitHook(observingHook);
+  uiManager_.registerCommitHook(cancellingHook);
+  uiManager_.registerCommitHook(mutatingHook);
+
+  commit(1);
+
+  // Hooks after the cancelling one are not called with a null tree.
+  EXPECT_EQ(calls, (std::vector<std::string>{"cancel"}));
+  EXPECT_EQ(getRootShadowNode(1), rootShadowNode);
+
+  uiManager_.unregisterCommitHook(mutatingHook);
+  uiManager_.unregisterCommitHook(cancellingHook);
+  uiManager_.unregisterCommitHook(observingHook);
+}
+
+} // namespace facebook::react
@@ -7,6 +7,7 @@
 
 #include "BufferedRuntimeExecutor.h"
 
+#include <cxxreact/SystraceSection.h>
 #include <algorithm>
 
 namespace facebook::react {
@@ -15,9 +16,12 @@ BufferedRuntimeExecutor::BufferedRuntimeExecutor(
     RuntimeExecutor runtimeExecutor)
     : runtimeExecutor_(runtimeExecutor),
       isBufferingEnabled_(true),
-      lastIndex_(0) {}
+      lastIndex_(0),
+      bufferingStartTime_(Clock::now()) {}
 
-void BufferedRuntimeExecutor::execute(Work&& callback) {
+void BufferedRuntimeExecutor::execute(
+    Work&& callback,
+    SchedulerPriority priority) {
   if (!isBufferingEnabled_) {
     // Fast path: Schedule directly to RuntimeExecutor, without locking
     runtimeExecutor_(std::move(callback));
@@ -32,7 +36,10 @@ void BufferedRuntimeExecutor::execute(Work&& callback) {
   uint64_t newIndex = lastIndex_++;
   std::scoped_lock guard(lock_);
   if (isBufferingEnabled_) {
-    queue_.push({.index_ = newIndex, .work_ = std::move(callback)});
+    queue_.push(
+        {.priority_ = priority,
+         .index_ = newIndex,
+         .work_ = std::move(callback)});
     return;
   }
 
@@ -44,8 +51,27 @@ void BufferedRuntimeExecutor::execute(Work&& callback) {
 
 void BufferedRuntimeExecutor::flush() {
   std::scoped_lock guard(lock_);
+  if (!isBufferingEnabled_) {
+    return;
+  }
+
+  auto numberOfBufferedCalls = queue_.size();
+  SystraceSection s(
+      "BufferedRuntimeExecutor::flush",
+      "numberOfBufferedCalls",
+      numberOfBufferedCalls);
   unsafeFlush();
   isBufferingEnabled_ = false;
+  bufferingWindow_ = BufferingWindow{
+      .startTime = bufferingStartTime_,
+      .endTime = Clock::now(),
+      .numberOfBufferedCalls = numberOfBufferedCalls};
+}
+
+std::optional<BufferedRuntimeExecutor::BufferingWindow>
+BufferedRuntimeExecutor::getBufferingWindow() const {
+  std::scoped_lock guard(lock_);
+  return bufferingWindow_;
 }
 
 void BufferedRuntimeExecutor::unsafeFlush() {
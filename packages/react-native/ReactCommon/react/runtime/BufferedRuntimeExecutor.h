@@ -8,8 +8,11 @@
 #pragma once
 
 #include <ReactCommon/RuntimeExecutor.h>
+#include <ReactCommon/SchedulerPriority.h>
 #include <jsi/jsi.h>
 #include <atomic>
+#include <chrono>
+#include <optional>
 #include <queue>
 
 namespace facebook::react {
@@ -17,34 +20,58 @@ namespace facebook::react {
 class BufferedRuntimeExecutor {
  public:
   using Work = std::function<void(jsi::Runtime& runtime)>;
+  using Clock = std::chrono::steady_clock;
 
-  // A utility structure to track pending work in the order of when they arrive.
+  // A utility structure to track pending work in the order of their priority
+  // and, within the same priority, of when they arrive.
   struct BufferedWork {
+    SchedulerPriority priority_;
     uint64_t index_;
     Work work_;
     bool operator<(const BufferedWork& rhs) const {
-      // Higher index has lower priority, so this inverted comparison puts
-      // the smaller index on top of the queue.
+      // Higher priority values and higher indices are less urgent, so these
+      // inverted comparisons put the most urgent, oldest work on top of the
+      // queue.
+      if (priority_ != rhs.priority_) {
+        return priority_ > rhs.priority_;
+      }
       return index_ > rhs.index_;
     }
   };
 
+  // Describes the time during which work was buffered, for startup metrics.
+  struct BufferingWindow {
+    Clock::time_point startTime;
+    Clock::time_point endTime;
+    size_t numberOfBufferedCalls;
+  };
+
   BufferedRuntimeExecutor(RuntimeExecutor runtimeExecutor);
 
-  void execute(Work&& callback);
+  // `priority` only orders work buffered until `flush`; the work itself is
+  // always forwarded to the `RuntimeExecutor` as is.
+  void execute(
+      Work&& callback,
+      SchedulerPriority priority = SchedulerPriority::ImmediatePriority);
 
-  // Flush buffered JS calls and then diable JS buffering
+  // Flush buffered JS calls and then diable JS buffering.
+  // Buffered calls are forwarded one by one in the order of their priority.
   void flush();
 
+  // Returns the buffering window once buffering has been disabled.
+  std::optional<BufferingWindow> getBufferingWindow() const;
+
  private:
   // Perform flushing without locking mechanism
   void unsafeFlush();
 
   RuntimeExecutor runtimeExecutor_;
   std::atomic<bool> isBufferingEnabled_;
-  std::mutex lock_;
+  mutable std::mutex lock_;
   std::atomic<uint64_t> lastIndex_;
   std::priority_queue<BufferedWork> queue_;
+  Clock::time_point bufferingStartTime_;
+  std::optional<BufferingWindow> bufferingWindow_;
 };
 
 } // namespace facebook::react
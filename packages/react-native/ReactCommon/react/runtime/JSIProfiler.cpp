@@ -0,0 +1,483 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include "JSIProfiler.h"
+
+#include <algorithm>
+#include <bit>
+#include <iomanip>
+#include <sstream>
+#include <typeinfo>
+
+#include <ReactCommon/TurboModule.h>
+#include <folly/Demangle.h>
+
+namespace facebook::react {
+
+namespace {
+
+const char* toString(JSIProfiler::CallKind kind) {
+  switch (kind) {
+    case JSIProfiler::CallKind::HostFunction:
+      return "call";
+    case JSIProfiler::CallKind::PropertyGet:
+      return "get";
+    case JSIProfiler::CallKind::PropertySet:
+      return "set";
+  }
+  return "";
+}
+
+size_t getHistogramBucket(std::chrono::nanoseconds duration) {
+  auto microseconds = static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+  return std::min<size_t>(
+      std::bit_width(microseconds), JSIProfiler::kNumberOfHistogramBuckets - 1);
+}
+
+double toMicroseconds(std::chrono::nanoseconds duration) {
+  return static_cast<double>(duration.count()) / 1000.0;
+}
+
+/*
+ * TurboModules are named by the module name; they all share a few C++ types
+ * (such as `ObjCTurboModule`), so these would merge entries of all modules.
+ */
+std::string getHostObjectName(const jsi::HostObject& hostObject) {
+  if (auto turboModule = dynamic_cast<const TurboModule*>(&hostObject)) {
+    return turboModule->getName();
+  }
+  return folly::demangle(typeid(hostObject)).toStdString();
+}
+
+} // namespace
+
+#pragma mark - JSIProfiler
+
+JSIProfiler::Entry& JSIProfiler::getEntry(
+    CallKind kind,
+    const std::string& name) {
+  auto key = std::string{toString(kind)} + ":" + name;
+
+  std::scoped_lock lock(mutex_);
+  auto& entry = entries_[key];
+  if (!entry) {
+    entry = std::make_unique<Entry>();
+    entry->kind = kind;
+    entry->name = name;
+  }
+  return *entry;
+}
+
+void JSIProfiler::record(
+    Entry& entry,
+    std::chrono::nanoseconds duration,
+    size_t numberOfArguments,
+    size_t numberOfStringBytes) {
+  auto bucket = getHistogramBucket(duration);
+
+  std::scoped_lock lock(mutex_);
+  entry.numberOfCalls++;
+  entry.totalDuration += duration;
+  entry.maxDuration = std::max(entry.maxDuration, duration);
+  entry.numberOfArguments += numberOfArguments;
+  entry.numberOfStringBytes += numberOfStringBytes;
+  entry.histogram[bucket]++;
+}
+
+std::vector<JSIProfiler::Entry> JSIProfiler::getEntries() const {
+  auto entries = std::vector<Entry>{};
+
+  {
+    std::scoped_lock lock(mutex_);
+    entries.reserve(entries_.size());
+    for (const auto& pair : entries_) {
+      if (pair.second->numberOfCalls > 0) {
+        entries.push_back(*pair.second);
+      }
+    }
+  }
+
+  std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+    if (a.totalDuration != b.totalDuration) {
+      return a.totalDuration > b.totalDuration;
+    }
+    return a.numberOfCalls > b.numberOfCalls;
+  });
+  return entries;
+}
+
+std::string JSIProfiler::getReport(size_t maxNumberOfEntries) const {
+  auto entries = getEntries();
+
+  auto stream = std::ostringstream{};
+  stream << std::fixed << std::setprecision(1);
+  stream << "JSI profile (" << entries.size()
+         << " entries, ranked by total time):\n";
+  stream << "kind\tcalls\ttotal us\tavg us\tmax us\targs\tstring bytes\tname\t"
+         << "latency histogram\n";
+
+  auto numberOfEntries = std::min(maxNumberOfEntries, entries.size());
+  for (size_t i = 0; i < numberOfEntries; i++) {
+    const auto& entry = entries[i];
+    stream << toString(entry.kind) << "\t" << entry.numberOfCalls << "\t"
+           << toMicroseconds(entry.totalDuration) << "\t"
+           << toMicroseconds(entry.totalDuration) /
+            static_cast<double>(entry.numberOfCalls)
+           << "\t" << toMicroseconds(entry.maxDuration) << "\t"
+           << entry.numberOfArguments << "\t" << entry.numberOfStringBytes
+           << "\t" << entry.name << "\t";
+
+    for (size_t bucket = 0; bucket < kNumberOfHistogramBuckets; bucket++) {
+      auto count = entry.histogram[bucket];
+      if (count == 0) {
+        continue;
+      }
+      if (bucket == kNumberOfHistogramBuckets - 1) {
+        stream << ">=" << (uint64_t{1} << (bucket - 1)) << "us:" << count
+               << " ";
+      } else {
+        stream << "<" << (uint64_t{1} << bucket) << "us:" << count << " ";
+      }
+    }
+    stream << "\n";
+  }
+
+  return stream.str();
+}
+
+void JSIProfiler::reset() {
+  std::scoped_lock lock(mutex_);
+  for (auto& pair : entries_) {
+    auto& entry = *pair.second;
+    entry = Entry{.kind = entry.kind, .name = std::move(entry.name)};
+  }
+}
+
+#pragma mark - JSIProfilingRuntime
+
+/*
+ * Measures a single call and reports it to the profiler on destruction
+ * (including the case when the call throws).
+ */
+class JSIProfilingRuntime::CallScope final {
+ public:
+  CallScope(
+      JSIProfilingRuntime& runtime,
+      JSIProfiler::Entry& entry,
+      size_t numberOfArguments)
+      : runtime_(runtime),
+        entry_(entry),
+        numberOfArguments_(numberOfArguments),
+        numberOfStringBytesAtStart_(runtime.numberOfStringBytes_),
+        startTime_(std::chrono::steady_clock::now()) {}
+
+  ~CallScope() {
+    runtime_.profiler_->record(
+        entry_,
+        std::chrono::steady_clock::now() - startTime_,
+        numberOfArguments_,
+        runtime_.numberOfStringBytes_ - numberOfStringBytesAtStart_);
+  }
+
+  CallScope(const CallScope&) = delete;
+  CallScope& operator=(const CallScope&) = delete;
+
+ private:
+  JSIProfilingRuntime& runtime_;
+  JSIProfiler::Entry& entry_;
+  size_t numberOfArguments_;
+  size_t numberOfStringBytesAtStart_;
+  std::chrono::steady_clock::time_point startTime_;
+};
+
+class JSIProfilingRuntime::ProfiledHostFunction final {
+ public:
+  ProfiledHostFunction(
+      JSIProfilingRuntime& runtime,
+      JSIProfiler::Entry& entry,
+      jsi::HostFunctionType plainHostFunction)
+      : runtime_(runtime),
+        entry_(entry),
+        plainHostFunction_(std::move(plainHostFunction)) {}
+
+  jsi::Value operator()(
+      jsi::Runtime& runtime,
+      const jsi::Value& thisValue,
+      const jsi::Value* args,
+      size_t count) {
+    auto scope = CallScope{runtime_, entry_, count};
+    return plainHostFunction_(runtime, thisValue, args, count);
+  }
+
+  jsi::HostFunctionType& getPlainHostFunction() {
+    return plainHostFunction_;
+  }
+
+ private:
+  JSIProfilingRuntime& runtime_;
+  JSIProfiler::Entry& entry_;
+  jsi::HostFunctionType plainHostFunction_;
+};
+
+/*
+ * Makes the host object whose property is being accessed the owner of the
+ * host functions created in the meantime (e.g. methods of TurboModules), so
+ * their entries are named after it. Methods of TurboModules which install
+ * them eagerly are created before the module object and keep bare names.
+ */
+class JSIProfilingRuntime::OwnerScope final {
+ public:
+  OwnerScope(JSIProfilingRuntime& runtime, const std::string& ownerName)
+      : runtime_(runtime), previousOwnerName_(runtime.ownerName_) {
+    runtime_.ownerName_ = &ownerName;
+  }
+
+  ~OwnerScope() {
+    runtime_.ownerName_ = previousOwnerName_;
+  }
+
+  OwnerScope(const OwnerScope&) = delete;
+  OwnerScope& operator=(const OwnerScope&) = delete;
+
+ private:
+  JSIProfilingRuntime& runtime_;
+  const std::string* previousOwnerName_;
+};
+
+class JSIProfilingRuntime::ProfiledHostObject final : public jsi::HostObject {
+ public:
+  ProfiledHostObject(
+      JSIProfilingRuntime& runtime,
+      std::shared_ptr<jsi::HostObject> plainHostObject)
+      : runtime_(runtime),
+        plainHostObject_(std::move(plainHostObject)),
+        name_(getHostObjectName(*plainHostObject_)) {}
+
+  jsi::Value get(jsi::Runtime& runtime, const jsi::PropNameID& name)
+      override {
+    auto scope = CallScope{
+        runtime_,
+        getEntry(getEntries_, JSIProfiler::CallKind::PropertyGet, name),
+        0};
+    auto ownerScope = OwnerScope{runtime_, name_};
+    return plainHostObject_->get(runtime, name);
+  }
+
+  void set(
+      jsi::Runtime& runtime,
+      const jsi::PropNameID& name,
+      const jsi::Value& value) override {
+    auto scope = CallScope{
+        runtime_,
+        getEntry(setEntries_, JSIProfiler::CallKind::PropertySet, name),
+        1};
+    plainHostObject_->set(runtime, name, value);
+  }
+
+  std::vector<jsi::PropNameID> getPropertyNames(
+      jsi::Runtime& runtime) override {
+    return plainHostObject_->getPropertyNames(runtime);
+  }
+
+  const std::shared_ptr<jsi::HostObject>& getPlainHostObject() const {
+    return plainHostObject_;
+  }
+
+ private:
+  using CachedEntries =
+      std::vector<std::pair<jsi::PropNameID, JSIProfiler::Entry*>>;
+
+  /*
+   * Entries are cached per property, so repeated accesses neither build the
+   * name nor look it up in the profiler. Host objects usually have a handful
+   * of properties (and TurboModules cache them in JS after the first access),
+   * so a linear search is enough.
+   */
+  JSIProfiler::Entry& getEntry(
+      CachedEntries& cachedEntries,
+      JSIProfiler::CallKind kind,
+      const jsi::PropNameID& name) {
+    // Using the plain runtime so the conversions are not accounted.
+    auto& runtime = runtime_.plain();
+    for (const auto& [cachedName, entry] : cachedEntries) {
+      if (jsi::PropNameID::compare(runtime, cachedName, name)) {
+        return *entry;
+      }
+    }
+
+    auto& entry =
+        runtime_.profiler_->getEntry(kind, name_ + "." + name.utf8(runtime));
+    cachedEntries.emplace_back(jsi::PropNameID{runtime, name}, &entry);
+    return entry;
+  }
+
+  JSIProfilingRuntime& runtime_;
+  std::shared_ptr<jsi::HostObject> plainHostObject_;
+  std::string name_;
+  CachedEntries getEntries_;
+  CachedEntries setEntries_;
+};
+
+JSIProfilingRuntime::JSIProfilingRuntime(
+    jsi::Runtime& runtime,
+    std::shared_ptr<JSIProfiler> profiler)
+    : RuntimeDecorator(runtime), profiler_(std::move(profiler)) {}
+
+jsi::Object JSIProfilingRuntime::createObject() {
+  return RuntimeDecorator::createObject();
+}
+
+jsi::Object JSIProfilingRuntime::createObject(
+    std::shared_ptr<jsi::HostObject> ho) {
+  return RuntimeDecorator::createObject(
+      std::make_shared<ProfiledHostObject>(*this, std::move(ho)));
+}
+
+std::shared_ptr<jsi::HostObject> JSIProfilingRuntime::getHostObject(
+    const jsi::Object& o) {
+  auto hostObject = RuntimeDecorator::getHostObject(o);
+  if (auto profiledHostObject =
+          std::dynamic_pointer_cast<ProfiledHostObject>(hostObject)) {
+    return profiledHostObject->getPlainHostObject();
+  }
+  return hostObject;
+}
+
+jsi::Function JSIProfilingRuntime::createFunctionFromHostFunction(
+    const jsi::PropNameID& name,
+    unsigned int paramCount,
+    jsi::HostFunctionType func) {
+  // Using the plain runtime so the conversion is not accounted.
+  auto functionName = name.utf8(plain());
+  auto& entry = profiler_->getEntry(
+      JSIProfiler::CallKind::HostFunction,
+      ownerName_ != nullptr ? *ownerName_ + "." + functionName
+                            : functionName);
+  return RuntimeDecorator::createFunctionFromHostFunction(
+      name, paramCount, ProfiledHostFunction(*this, entry, std::move(func)));
+}
+
+jsi::HostFunctionType& JSIProfilingRuntime::getHostFunction(
+    const jsi::Function& f) {
+  auto& hostFunction = RuntimeDecorator::getHostFunction(f);
+  if (auto profiledHostFunction = hostFunction.target<ProfiledHostFunction>()) {
+    return profiledHostFunction->getPlainHostFunction();
+  }
+  return hostFunction;
+}
+
+jsi::PropNameID JSIProfilingRuntime::createPropNameIDFromAscii(
+    const char* str,
+    size_t length) {
+  numberOfStringBytes_ += length;
+  return RuntimeDecorator::createPropNameIDFromAscii(str, length);
+}
+
+jsi::PropNameID JSIProfilingRuntime::createPropNameIDFromUtf8(
+    const uint8_t* utf8,
+    size_t length) {
+  numberOfStringBytes_ += length;
+  return RuntimeDecorator::createPropNameIDFromUtf8(utf8, length);
+}
+
+std::string JSIProfilingRuntime::utf8(const jsi::PropNameID& id) {
+  auto result = RuntimeDecorator::utf8(id);
+  numberOfStringBytes_ += result.size();
+  return result;
+}
+
+jsi::String JSIProfilingRuntime::createStringFromAscii(
+    const char* str,
+    size_t length) {
+  numberOfStringBytes_ += length;
+  return RuntimeDecorator::createStringFromAscii(str, length);
+}
+
+jsi::String JSIProfilingRuntime::createStringFromUtf8(
+    const uint8_t* utf8,
+    size_t length) {
+  numberOfStringBytes_ += length;
+  return RuntimeDecorator::createStringFromUtf8(utf8, length);
+}
+
+std::string JSIProfilingRuntime::utf8(const jsi::String& str) {
+  auto result = RuntimeDecorator::utf8(str);
+  numberOfStringBytes_ += result.size();
+  return result;
+}
+
+std::u16string JSIProfilingRuntime::utf16(const jsi::String& str) {
+  auto result = RuntimeDecorator::utf16(str);
+  numberOfStringBytes_ += result.size() * sizeof(char16_t);
+  return result;
+}
+
+std::u16string JSIProfilingRuntime::utf16(const jsi::PropNameID& id) {
+  auto result = RuntimeDecorator::utf16(id);
+  numberOfStringBytes_ += result.size() * sizeof(char16_t);
+  return result;
+}
+
+#pragma mark - JSIProfilingJSRuntimeFactory
+
+namespace {
+
+/*
+ * Owns a `JSRuntime` and exposes its runtime decorated with
+ * `JSIProfilingRuntime`.
+ */
+class JSIProfilingJSRuntime final : public JSRuntime {
+ public:
+  JSIProfilingJSRuntime(
+      std::unique_ptr<JSRuntime> jsRuntime,
+      std::shared_ptr<JSIProfiler> profiler)
+      : jsRuntime_(std::move(jsRuntime)),
+        runtime_(jsRuntime_->getRuntime(), std::move(profiler)) {}
+
+  jsi::Runtime& getRuntime() noexcept override {
+    return runtime_;
+  }
+
+  jsinspector_modern::RuntimeTargetDelegate& getRuntimeTargetDelegate()
+      override {
+    return jsRuntime_->getRuntimeTargetDelegate();
+  }
+
+  void unstable_initializeOnJsThread() override {
+    jsRuntime_->unstable_initializeOnJsThread();
+  }
+
+  bool canPrepareJavaScriptOffJsThread() override {
+    return jsRuntime_->canPrepareJavaScriptOffJsThread();
+  }
+
+ private:
+  std::unique_ptr<JSRuntime> jsRuntime_;
+  JSIProfilingRuntime runtime_;
+};
+
+} // namespace
+
+JSIProfilingJSRuntimeFactory::JSIProfilingJSRuntimeFactory(
+    std::shared_ptr<JSRuntimeFactory> jsRuntimeFactory,
+    std::shared_ptr<JSIProfiler> profiler)
+    : jsRuntimeFactory_(std::move(jsRuntimeFactory)),
+      profiler_(std::move(profiler)) {}
+
+std::unique_ptr<JSRuntime> JSIProfilingJSRuntimeFactory::createJSRuntime(
+    std::shared_ptr<MessageQueueThread> msgQueueThread) noexcept {
+  auto jsRuntime =
+      jsRuntimeFactory_->createJSRuntime(std::move(msgQueueThread));
+  if (!jsRuntime) {
+    return nullptr;
+  }
+  return std::make_unique<JSIProfilingJSRuntime>(
+      std::move(jsRuntime), profiler_);
+}
+
+} // namespace facebook::react
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <jsi/decorator.h>
+#include <jsi/jsi.h>
+#include <react/runtime/JSRuntimeFactory.h>
+
+namespace facebook::react {
+
+/**
+ * Collects statistics about crossings from JavaScript into native code:
+ * calls of host functions and property accesses of host objects.
+ * Statistics are aggregated by name (qualified by the name of the owning
+ * host object, e.g. the TurboModule) and can be dumped as a report ranked by
+ * the total time spent in the native code.
+ * The class is thread-safe.
+ */
+class JSIProfiler final {
+ public:
+  enum class CallKind {
+    HostFunction,
+    PropertyGet,
+    PropertySet,
+  };
+
+  static constexpr size_t kNumberOfHistogramBuckets = 16;
+
+  struct Entry {
+    CallKind kind;
+    std::string name;
+    uint64_t numberOfCalls{0};
+    std::chrono::nanoseconds totalDuration{0};
+    std::chrono::nanoseconds maxDuration{0};
+    uint64_t numberOfArguments{0};
+
+    /*
+     * The number of bytes of strings created from or converted to C++ strings
+     * while the call was in progress.
+     */
+    uint64_t numberOfStringBytes{0};
+
+    /*
+     * Latency histogram. The first bucket counts calls which took less than
+     * 1 microsecond, bucket `i` counts calls which took [2^(i-1), 2^i)
+     * microseconds, and the last bucket counts everything slower.
+     */
+    std::array<uint64_t, kNumberOfHistogramBuckets> histogram{};
+  };
+
+  /*
+   * Returns an entry for given `kind` and `name`, creating it if needed.
+   * The reference stays valid for the lifetime of the profiler.
+   */
+  Entry& getEntry(CallKind kind, const std::string& name);
+
+  /*
+   * Accounts a single call of `entry`.
+   */
+  void record(
+      Entry& entry,
+      std::chrono::nanoseconds duration,
+      size_t numberOfArguments,
+      size_t numberOfStringBytes);
+
+  /*
+   * Returns copies of all non-empty entries ranked by the total duration.
+   */
+  std::vector<Entry> getEntries() const;
+
+  /*
+   * Returns a human-readable report of (at most `maxNumberOfEntries`) entries
+   * ranked by the total duration.
+   */
+  std::string getReport(size_t maxNumberOfEntries = 50) const;
+
+  /*
+   * Zeroes all collected statistics.
+   */
+  void reset();
+
+ private:
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, std::unique_ptr<Entry>>
+      entries_; // Protected by `mutex_`.
+};
+
+/**
+ * A `jsi::Runtime` decorator which reports all calls of host functions and
+ * property accesses of host objects (wrapped at creation time) to a
+ * `JSIProfiler`. Durations and string conversions of nested calls are
+ * included in the outer call.
+ */
+class JSIProfilingRuntime final : public jsi::RuntimeDecorator<jsi::Runtime> {
+ public:
+  JSIProfilingRuntime(
+      jsi::Runtime& runtime,
+      std::shared_ptr<JSIProfiler> profiler);
+
+  jsi::Object createObject() override;
+  jsi::Object createObject(std::shared_ptr<jsi::HostObject> ho) override;
+  std::shared_ptr<jsi::HostObject> getHostObject(
+      const jsi::Object& o) override;
+
+  jsi::Function createFunctionFromHostFunction(
+      const jsi::PropNameID& name,
+      unsigned int paramCount,
+      jsi::HostFunctionType func) override;
+  jsi::HostFunctionType& getHostFunction(const jsi::Function& f) override;
+
+  jsi::PropNameID createPropNameIDFromAscii(const char* str, size_t length)
+      override;
+  jsi::PropNameID createPropNameIDFromUtf8(const uint8_t* utf8, size_t length)
+      override;
+  std::string utf8(const jsi::PropNameID& id) override;
+
+  jsi::String createStringFromAscii(const char* str, size_t length) override;
+  jsi::String createStringFromUtf8(const uint8_t* utf8, size_t length)
+      override;
+  std::string utf8(const jsi::String& str) override;
+  std::u16string utf16(const jsi::String& str) override;
+  std::u16string utf16(const jsi::PropNameID& id) override;
+
+ private:
+  class CallScope;
+  class OwnerScope;
+  class ProfiledHostFunction;
+  class ProfiledHostObject;
+
+  std::shared_ptr<JSIProfiler> profiler_;
+
+  // Name of the host object whose property is being accessed, if any; only
+  // touched on the JS thread.
+  const std::string* ownerName_{nullptr};
+
+  // Total number of converted string bytes; only touched on the JS thread.
+  size_t numberOfStringBytes_{0};
+};
+
+/**
+ * A `JSRuntimeFactory` which decorates runtimes created by another factory
+ * with `JSIProfilingRuntime`. Meant to be installed in profiling builds only.
+ */
+class JSIProfilingJSRuntimeFactory final : public JSRuntimeFactory {
+ public:
+  JSIProfilingJSRuntimeFactory(
+      std::shared_ptr<JSRuntimeFactory> jsRuntimeFactory,
+      std::shared_ptr<JSIProfiler> profiler);
+
+  std::unique_ptr<JSRuntime> createJSRuntime(
+      std::shared_ptr<MessageQueueThread> msgQueueThread) noexcept override;
+
+ private:
+  std::shared_ptr<JSRuntimeFactory> jsRuntimeFactory_;
+  std::shared_ptr<JSIProfiler> profiler_;
+};
+
+} // namespace facebook::react
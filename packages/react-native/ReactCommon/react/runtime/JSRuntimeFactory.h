@@ -38,6 +38,16 @@ class JSRuntime {
    */
   virtual void unstable_initializeOnJsThread() {}
 
+  /**
+   * Whether \c getRuntime().prepareJavaScript() may be called on a thread
+   * other than the JS thread, concurrently with JS thread work. When it may,
+   * \c ReactInstance prepares the bundle in the background while the rest of
+   * the app is being initialized.
+   */
+  virtual bool canPrepareJavaScriptOffJsThread() {
+    return false;
+  }
+
  private:
   /**
    * Initialized by \c getRuntimeTargetDelegate if not overridden, and then
@@ -185,6 +185,12 @@ void ReactInstance::unregisterFromInspector() {
   }
 }
 
+ReactInstance::~ReactInstance() {
+  if (preparedScript_.valid()) {
+    preparedScript_.wait();
+  }
+}
+
 RuntimeExecutor ReactInstance::getUnbufferedRuntimeExecutor() noexcept {
   return [runtimeScheduler = runtimeScheduler_.get()](
              std::function<void(jsi::Runtime & runtime)>&& callback) {
@@ -196,17 +202,29 @@ RuntimeExecutor ReactInstance::getUnbufferedRuntimeExecutor() noexcept {
 // execution before any JS queued into it from C++ are executed. Use
 // getUnbufferedRuntimeExecutor() instead if you do not need the main JS bundle
 // to have finished. e.g. setting global variables into JS runtime.
-RuntimeExecutor ReactInstance::getBufferedRuntimeExecutor() noexcept {
+// Work buffered until then is flushed in the order of `priority`, so that
+// e.g. surface starts don't wait for less urgent work queued before them.
+// Once flushed, all work is scheduled the same way regardless of `priority`.
+RuntimeExecutor ReactInstance::getBufferedRuntimeExecutor(
+    SchedulerPriority priority) noexcept {
   return [weakBufferedRuntimeExecutor_ =
-              std::weak_ptr<BufferedRuntimeExecutor>(bufferedRuntimeExecutor_)](
-             std::function<void(jsi::Runtime & runtime)>&& callback) {
+              std::weak_ptr<BufferedRuntimeExecutor>(bufferedRuntimeExecutor_),
+          priority](std::function<void(jsi::Runtime & runtime)>&& callback) {
     if (auto strongBufferedRuntimeExecutor_ =
             weakBufferedRuntimeExecutor_.lock()) {
-      strongBufferedRuntimeExecutor_->execute(std::move(callback));
+      strongBufferedRuntimeExecutor_->execute(std::move(callback), priority);
     }
   };
 }
 
+std::optional<BufferedRuntimeExecutor::BufferingWindow>
+ReactInstance::getBufferingWindow() const {
+  if (bufferedRuntimeExecutor_ == nullptr) {
+    return std::nullopt;
+  }
+  return bufferedRuntimeExecutor_->getBufferingWindow();
+}
+
 // TODO(T184010230): Should the RuntimeScheduler returned from this method be
 // buffered?
 std::shared_ptr<RuntimeScheduler>
@@ -238,21 +256,60 @@ void ReactInstance::loadScript(
   auto buffer = std::make_shared<BigStringBuffer>(std::move(script));
   std::string scriptName = simpleBasename(sourceURL);
 
+  /**
+   * Parsing and verifying the bundle doesn't need the JS thread, so let it
+   * run in parallel with the setup of native modules and surfaces which
+   * happens before the JS thread gets to the task scheduled below.
+   */
+  std::shared_future<std::shared_ptr<const jsi::PreparedJavaScript>>
+      preparedScript;
+  if (runtime_->canPrepareJavaScriptOffJsThread()) {
+    if (ReactMarker::logTaggedMarkerBridgelessImpl) {
+      ReactMarker::logTaggedMarkerBridgeless(
+          ReactMarker::PREPARE_JS_BUNDLE_START, scriptName.c_str());
+    }
+    auto prepare = [&runtime = runtime_->getRuntime(), buffer, sourceURL]() {
+      SystraceSection s("ReactInstance::loadScript::prepareJavaScript");
+      return runtime.prepareJavaScript(buffer, sourceURL);
+    };
+    preparedScript_ =
+        std::async(std::launch::async, std::move(prepare)).share();
+    preparedScript = preparedScript_;
+  }
+
   runtimeScheduler_->scheduleWork(
       [this,
        scriptName,
        sourceURL,
        buffer = std::move(buffer),
+       preparedScript = std::move(preparedScript),
        weakBufferedRuntimeExecuter = std::weak_ptr<BufferedRuntimeExecutor>(
            bufferedRuntimeExecutor_)](jsi::Runtime& runtime) {
         SystraceSection s("ReactInstance::loadScript");
         bool hasLogger(ReactMarker::logTaggedMarkerBridgelessImpl);
+
+        std::shared_ptr<const jsi::PreparedJavaScript> prepared;
+        if (preparedScript.valid()) {
+          // Markers can't be logged from the background thread (it's unknown
+          // to the platform), so the preparation is considered done when the
+          // JS thread gets its result.
+          prepared = preparedScript.get();
+          if (hasLogger) {
+            ReactMarker::logTaggedMarkerBridgeless(
+                ReactMarker::PREPARE_JS_BUNDLE_STOP, scriptName.c_str());
+          }
+        }
+
         if (hasLogger) {
           ReactMarker::logTaggedMarkerBridgeless(
               ReactMarker::RUN_JS_BUNDLE_START, scriptName.c_str());
         }
 
-        runtime.evaluateJavaScript(buffer, sourceURL);
+        if (prepared) {
+          runtime.evaluatePreparedJavaScript(prepared);
+        } else {
+          runtime.evaluateJavaScript(buffer, sourceURL);
+        }
 
         /**
          * TODO(T183610671): We need a safe/reliable way to enable the js
@@ -263,6 +320,11 @@ void ReactInstance::loadScript(
           jsErrorHandler_->setRuntimeReady();
         }
 
+        // Feature flags are final once the main bundle has run. Resolve them
+        // once so that the hot paths reading them don't go through the
+        // provider anymore.
+        ReactNativeFeatureFlags::freeze();
+
         if (hasLogger) {
           ReactMarker::logTaggedMarkerBridgeless(
               ReactMarker::RUN_JS_BUNDLE_STOP, scriptName.c_str());
@@ -17,6 +17,7 @@
 #include <react/runtime/BufferedRuntimeExecutor.h>
 #include <react/runtime/JSRuntimeFactory.h>
 #include <react/runtime/TimerManager.h>
+#include <future>
 #include <vector>
 
 namespace facebook::react {
@@ -32,9 +33,20 @@ class ReactInstance final : private jsinspector_modern::InstanceTargetDelegate {
       JsErrorHandler::OnJsError onJsError,
       jsinspector_modern::HostTarget* parentInspectorTarget = nullptr);
 
+  ~ReactInstance() override;
+
   RuntimeExecutor getUnbufferedRuntimeExecutor() noexcept;
 
-  RuntimeExecutor getBufferedRuntimeExecutor() noexcept;
+  RuntimeExecutor getBufferedRuntimeExecutor(
+      SchedulerPriority priority =
+          SchedulerPriority::ImmediatePriority) noexcept;
+
+  /**
+   * Returns the time during which JS calls were buffered waiting for the main
+   * JS bundle, once it has been loaded.
+   */
+  std::optional<BufferedRuntimeExecutor::BufferingWindow> getBufferingWindow()
+      const;
 
   std::shared_ptr<RuntimeScheduler> getRuntimeScheduler() noexcept;
 
@@ -78,6 +90,14 @@ class ReactInstance final : private jsinspector_modern::InstanceTargetDelegate {
   std::shared_ptr<RuntimeScheduler> runtimeScheduler_;
   std::shared_ptr<JsErrorHandler> jsErrorHandler_;
 
+  /*
+   * The bundle being prepared off the JS thread by `loadScript`, if the
+   * runtime supports it. The preparation uses `runtime_`, so it's awaited
+   * before the instance is destroyed.
+   */
+  std::shared_future<std::shared_ptr<const jsi::PreparedJavaScript>>
+      preparedScript_;
+
   jsinspector_modern::InstanceTarget* inspectorTarget_{nullptr};
   jsinspector_modern::RuntimeTarget* runtimeInspectorTarget_{nullptr};
   jsinspector_modern::HostTarget* parentInspectorTarget_{nullptr};
@@ -113,6 +113,12 @@ class HermesJSRuntime : public JSRuntime {
     runtime_->registerForProfiling();
   }
 
+  bool canPrepareJavaScriptOffJsThread() override {
+    // Preparing only compiles or verifies the bundle, without touching the
+    // state of the VM.
+    return true;
+  }
+
  private:
   std::shared_ptr<HermesRuntime> runtime_;
   std::optional<jsinspector_modern::HermesRuntimeTargetDelegate>
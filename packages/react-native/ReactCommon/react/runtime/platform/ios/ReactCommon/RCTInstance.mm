@@ -237,7 +237,9 @@ void RCTInstanceSetRuntimeDiagnosticFlags(NSString *flags)
   _valid = true;
 
   RuntimeExecutor bufferedRuntimeExecutor = _reactInstance->getBufferedRuntimeExecutor();
-  timerManager->setRuntimeExecutor(bufferedRuntimeExecutor);
+  // Timers queued while the JS bundle loads don't need to run before surface starts and calls from native queued in
+  // the meantime.
+  timerManager->setRuntimeExecutor(_reactInstance->getBufferedRuntimeExecutor(SchedulerPriority::NormalPriority));
 
   auto jsCallInvoker = make_shared<RuntimeSchedulerCallInvoker>(_reactInstance->getRuntimeScheduler());
   RCTBridgeProxy *bridgeProxy =
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/featureflags/ReactNativeFeatureFlags.h>
+#include <react/featureflags/ReactNativeFeatureFlagsDefaults.h>
+#include <react/renderer/runtimescheduler/RuntimeScheduler.h>
+#include <react/runtime/BufferedRuntimeExecutor.h>
+
+namespace facebook::react {
+
+namespace {
+
+class BridgelessFeatureFlags : public ReactNativeFeatureFlagsDefaults {
+ public:
+  bool enableBridgelessArchitecture() override {
+    return true;
+  }
+};
+
+} // namespace
+
+class BufferedRuntimeExecutorTest : public ::testing::Test {
+ protected:
+  BufferedRuntimeExecutorTest()
+      : runtime_(hermes::makeHermesRuntime(
+            ::hermes::vm::RuntimeConfig::Builder()
+                .withMicrotaskQueue(true)
+                .build())),
+        executor_([this](BufferedRuntimeExecutor::Work&& work) {
+          scheduled_.push_back(std::move(work));
+        }) {}
+
+  // Runs the work forwarded by the executor in the order it was forwarded.
+  void runScheduledWork() {
+    for (size_t i = 0; i < scheduled_.size(); i++) {
+      auto work = std::move(scheduled_[i]);
+      work(*runtime_);
+    }
+    scheduled_.clear();
+  }
+
+  std::unique_ptr<jsi::Runtime> runtime_;
+  std::vector<BufferedRuntimeExecutor::Work> scheduled_;
+  BufferedRuntimeExecutor executor_;
+};
+
+TEST_F(BufferedRuntimeExecutorTest, flushesInPriorityOrder) {
+  std::vector<int> calls;
+  auto record = [&](int value) {
+    return [&calls, value](jsi::Runtime& /*runtime*/) {
+      calls.push_back(value);
+    };
+  };
+
+  executor_.execute(record(1), SchedulerPriority::LowPriority);
+  executor_.execute(record(2), SchedulerPriority::NormalPriority);
+  executor_.execute(record(3));
+  executor_.execute(record(4), SchedulerPriority::LowPriority);
+  executor_.execute(record(5));
+  EXPECT_TRUE(scheduled_.empty());
+  EXPECT_FALSE(executor_.getBufferingWindow().has_value());
+
+  executor_.flush();
+
+  // Every buffered call is forwarded on its own.
+  ASSERT_EQ(scheduled_.size(), 5);
+  runScheduledWork();
+  EXPECT_EQ(calls, (std::vector<int>{3, 5, 2, 1, 4}));
+
+  auto bufferingWindow = executor_.getBufferingWindow();
+  ASSERT_TRUE(bufferingWindow.has_value());
+  EXPECT_EQ(bufferingWindow->numberOfBufferedCalls, 5);
+  EXPECT_LE(bufferingWindow->startTime, bufferingWindow->endTime);
+
+  // Calls are no longer buffered (nor reordered) after flushing.
+  executor_.execute(record(6), SchedulerPriority::IdlePriority);
+  executor_.execute(record(7));
+  ASSERT_EQ(scheduled_.size(), 2);
+  runScheduledWork();
+  EXPECT_EQ(calls, (std::vector<int>{3, 5, 2, 1, 4, 6, 7}));
+}
+
+TEST_F(BufferedRuntimeExecutorTest, runsMicrotasksAfterEveryBufferedCall) {
+  ReactNativeFeatureFlags::override(
+      std::make_unique<BridgelessFeatureFlags>());
+
+  // Forwarding to `scheduleWork` like `ReactInstance` does.
+  auto runtimeScheduler =
+      RuntimeScheduler([this](BufferedRuntimeExecutor::Work&& work) {
+        scheduled_.push_back(std::move(work));
+      });
+  auto executor =
+      BufferedRuntimeExecutor([&](BufferedRuntimeExecutor::Work&& work) {
+        runtimeScheduler.scheduleWork(std::move(work));
+      });
+
+  std::vector<std::string> calls;
+  auto record = [&](std::string name) {
+    return [&calls, name](jsi::Runtime& runtime) {
+      calls.push_back(name);
+      runtime.queueMicrotask(jsi::Function::createFromHostFunction(
+          runtime,
+          jsi::PropNameID::forAscii(runtime, "microtask"),
+          0,
+          [&calls, name](
+              jsi::Runtime& /*runtime*/,
+              const jsi::Value& /*thisValue*/,
+              const jsi::Value* /*args*/,
+              size_t /*count*/) {
+            calls.push_back(name + " microtask");
+            return jsi::Value::undefined();
+          }));
+    };
+  };
+
+  executor.execute(record("timer"), SchedulerPriority::NormalPriority);
+  executor.execute(record("first call"));
+  executor.execute(record("second call"));
+  executor.flush();
+
+  while (!scheduled_.empty()) {
+    runScheduledWork();
+  }
+
+  // Buffered calls are separate tasks, so microtasks queued by one of them
+  // run before the next one.
+  EXPECT_EQ(
+      calls,
+      (std::vector<std::string>{
+          "first call",
+          "first call microtask",
+          "second call",
+          "second call microtask",
+          "timer",
+          "timer microtask"}));
+
+  ReactNativeFeatureFlags::dangerouslyReset();
+}
+
+} // namespace facebook::react
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <memory>
+#include <numeric>
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include <ReactCommon/TurboModule.h>
+#include <hermes/hermes.h>
+#include <jsi/jsi.h>
+#include <react/runtime/JSIProfiler.h>
+
+namespace facebook::react {
+
+namespace {
+
+class TestHostObject : public jsi::HostObject {
+ public:
+  jsi::Value get(jsi::Runtime& /*runtime*/, const jsi::PropNameID& /*name*/)
+      override {
+    return {42};
+  }
+
+  void set(
+      jsi::Runtime& /*runtime*/,
+      const jsi::PropNameID& /*name*/,
+      const jsi::Value& value) override {
+    lastValue = value.asNumber();
+  }
+
+  double lastValue{0};
+};
+
+class TestTurboModule : public TurboModule {
+ public:
+  explicit TestTurboModule(std::string name)
+      : TurboModule(std::move(name), nullptr) {
+    methodMap_["getValue"] = MethodMetadata{
+        .argCount = 0,
+        .invoker = [](jsi::Runtime& /*runtime*/,
+                      TurboModule& /*turboModule*/,
+                      const jsi::Value* /*args*/,
+                      size_t /*count*/) { return jsi::Value{42}; }};
+  }
+};
+
+const JSIProfiler::Entry* findEntry(
+    const std::vector<JSIProfiler::Entry>& entries,
+    JSIProfiler::CallKind kind,
+    const std::string& nameSuffix) {
+  for (const auto& entry : entries) {
+    if (entry.kind == kind && entry.name.size() >= nameSuffix.size() &&
+        entry.name.compare(
+            entry.name.size() - nameSuffix.size(),
+            nameSuffix.size(),
+            nameSuffix) == 0) {
+      return &entry;
+    }
+  }
+  return nullptr;
+}
+
+} // namespace
+
+class JSIProfilerTest : public ::testing::Test {
+ protected:
+  JSIProfilerTest()
+      : plainRuntime_(hermes::makeHermesRuntime()),
+        profiler_(std::make_shared<JSIProfiler>()),
+        runtime_(*plainRuntime_, profiler_) {}
+
+  void evaluate(const std::string& code) {
+    runtime_.evaluateJavaScript(
+        std::make_shared<jsi::StringBuffer>(code), "test.js");
+  }
+
+  std::unique_ptr<jsi::Runtime> plainRuntime_;
+  std::shared_ptr<JSIProfiler> profiler_;
+  JSIProfilingRuntime runtime_;
+};
+
+TEST_F(JSIProfilerTest, recordsHostFunctionCalls) {
+  auto greet = jsi::Function::createFromHostFunction(
+      runtime_,
+      jsi::PropNameID::forAscii(runtime_, "greet"),
+      1,
+      [](jsi::Runtime& runtime,
+         const jsi::Value& /*thisValue*/,
+         const jsi::Value* args,
+         size_t /*count*/) {
+        return jsi::String::createFromUtf8(
+            runtime, "Hello, " + args[0].asString(runtime).utf8(runtime));
+      });
+  runtime_.global().setProperty(runtime_, "greet", greet);
+
+  evaluate("greet('JSI'); greet('JSI', 'extra');");
+
+  auto entries = profiler_->getEntries();
+  auto entry =
+      findEntry(entries, JSIProfiler::CallKind::HostFunction, "greet");
+  ASSERT_NE(entry, nullptr);
+  EXPECT_EQ(entry->name, "greet");
+  EXPECT_EQ(entry->numberOfCalls, 2);
+  EXPECT_EQ(entry->numberOfArguments, 3);
+  // "JSI" converted to `std::string` and "Hello, JSI" created, twice.
+  EXPECT_EQ(entry->numberOfStringBytes, 2 * (3 + 10));
+  EXPECT_EQ(
+      std::accumulate(
+          entry->histogram.begin(), entry->histogram.end(), uint64_t{0}),
+      2);
+  EXPECT_LE(entry->maxDuration, entry->totalDuration);
+
+  // The original host function is still reachable.
+  EXPECT_TRUE(greet.isHostFunction(runtime_));
+  EXPECT_TRUE(static_cast<bool>(greet.getHostFunction(runtime_)));
+
+  EXPECT_NE(profiler_->getReport().find("greet"), std::string::npos);
+
+  profiler_->reset();
+  EXPECT_TRUE(profiler_->getEntries().empty());
+}
+
+TEST_F(JSIProfilerTest, recordsHostObjectPropertyAccesses) {
+  auto hostObject = std::make_shared<TestHostObject>();
+  runtime_.global().setProperty(
+      runtime_,
+      "hostObject",
+      jsi::Object::createFromHostObject(runtime_, hostObject));
+
+  evaluate("hostObject.value; hostObject.value; hostObject.value = 7;");
+
+  auto entries = profiler_->getEntries();
+  auto getEntry =
+      findEntry(entries, JSIProfiler::CallKind::PropertyGet, ".value");
+  ASSERT_NE(getEntry, nullptr);
+  EXPECT_EQ(getEntry->numberOfCalls, 2);
+
+  auto setEntry =
+      findEntry(entries, JSIProfiler::CallKind::PropertySet, ".value");
+  ASSERT_NE(setEntry, nullptr);
+  EXPECT_EQ(setEntry->numberOfCalls, 1);
+  EXPECT_EQ(hostObject->lastValue, 7);
+
+  // Host objects are unwrapped when requested back from the runtime.
+  auto object = runtime_.global().getPropertyAsObject(runtime_, "hostObject");
+  EXPECT_EQ(object.getHostObject<TestHostObject>(runtime_), hostObject);
+}
+
+TEST_F(JSIProfilerTest, namesEntriesAfterTurboModules) {
+  runtime_.global().setProperty(
+      runtime_,
+      "moduleA",
+      jsi::Object::createFromHostObject(
+          runtime_, std::make_shared<TestTurboModule>("NativeA")));
+  runtime_.global().setProperty(
+      runtime_,
+      "moduleB",
+      jsi::Object::createFromHostObject(
+          runtime_, std::make_shared<TestTurboModule>("NativeB")));
+
+  evaluate("moduleA.getValue(); moduleA.getValue(); moduleB.getValue();");
+
+  // Modules of the same C++ type and their methods don't share entries.
+  auto entries = profiler_->getEntries();
+  for (const auto& [name, numberOfCalls] :
+       {std::pair{"NativeA.getValue", uint64_t{2}},
+        std::pair{"NativeB.getValue", uint64_t{1}}}) {
+    auto getEntry =
+        findEntry(entries, JSIProfiler::CallKind::PropertyGet, name);
+    ASSERT_NE(getEntry, nullptr);
+    EXPECT_EQ(getEntry->name, name);
+    EXPECT_EQ(getEntry->numberOfCalls, numberOfCalls);
+
+    auto callEntry =
+        findEntry(entries, JSIProfiler::CallKind::HostFunction, name);
+    ASSERT_NE(callEntry, nullptr);
+    EXPECT_EQ(callEntry->name, name);
+    EXPECT_EQ(callEntry->numberOfCalls, numberOfCalls);
+  }
+}
+
+} // namespace facebook::react
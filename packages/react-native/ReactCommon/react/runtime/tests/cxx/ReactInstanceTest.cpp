@@ -116,9 +116,12 @@ class ReactInstanceTest : public ::testing::Test {
  protected:
   ReactInstanceTest() {}
 
+  virtual std::unique_ptr<JSRuntime> createRuntime() {
+    return std::make_unique<JSIRuntimeHolder>(hermes::makeHermesRuntime());
+  }
+
   void SetUp() override {
-    auto runtime =
-        std::make_unique<JSIRuntimeHolder>(hermes::makeHermesRuntime());
+    auto runtime = createRuntime();
     runtime_ = &runtime->getRuntime();
     messageQueueThread_ = std::make_shared<MockMessageQueueThread>();
     auto mockRegistry = std::make_unique<MockTimerRegistry>();
@@ -229,6 +232,30 @@ TEST_F(ReactInstanceTest, testBridgelessFlagIsSet) {
   EXPECT_EQ(val.getBool(), true);
 }
 
+class OffJsThreadPreparingRuntime : public JSIRuntimeHolder {
+ public:
+  using JSIRuntimeHolder::JSIRuntimeHolder;
+
+  bool canPrepareJavaScriptOffJsThread() override {
+    return true;
+  }
+};
+
+class ReactInstanceOffJsThreadPreparationTest : public ReactInstanceTest {
+ protected:
+  std::unique_ptr<JSRuntime> createRuntime() override {
+    return std::make_unique<OffJsThreadPreparingRuntime>(
+        hermes::makeHermesRuntime());
+  }
+};
+
+TEST_F(ReactInstanceOffJsThreadPreparationTest, testLoadScript) {
+  initializeRuntimeWithScript("globalThis.loaded = true;");
+  auto val = eval("globalThis.loaded === true");
+  EXPECT_EQ(val.getBool(), true);
+  expectNoError();
+}
+
 TEST_F(ReactInstanceTest, testProfilingFlag) {
   auto valBefore = tryEval("__RCTProfileIsProfiling === true", "false");
   EXPECT_EQ(valBefore.getBool(), false);
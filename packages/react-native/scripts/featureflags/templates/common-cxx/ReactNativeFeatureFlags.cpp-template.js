@@ -26,14 +26,56 @@ export default function (definitions: FeatureFlagDefinitions): string {
 ${DO_NOT_MODIFY_COMMENT}
 
 #include "ReactNativeFeatureFlags.h"
+#include <atomic>
+#include <cassert>
+#include <mutex>
+#include <vector>
 
 namespace facebook::react {
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wglobal-constructors"
 std::unique_ptr<ReactNativeFeatureFlagsAccessor> accessor_;
+
+namespace {
+
+std::mutex snapshotMutex_;
+
+#ifdef RN_CONSTEXPR_FEATURE_FLAGS
+// The flags never change in this mode, so they have a single snapshot.
+const ReactNativeFeatureFlagsSnapshot constexprSnapshot_{
+${Object.entries(definitions.common)
+  .map(
+    ([flagName]) =>
+      `    .${flagName} = ReactNativeFeatureFlagsConstexprValues::${flagName},`,
+  )
+  .join('\n')}
+};
+
+// Overrides can't change the flags in this mode, so debug builds check that
+// they provide the same values instead.
+void checkOverride(
+    [[maybe_unused]] std::unique_ptr<ReactNativeFeatureFlagsProvider>
+        provider) {
+#ifndef NDEBUG
+  ReactNativeFeatureFlagsAccessor accessor;
+  accessor.override(std::move(provider));
+  assert(
+      accessor.snapshot() == constexprSnapshot_ &&
+      "Feature flags must be overridden with their compile-time values");
+#endif
+}
+#else
+// Snapshots are never destroyed, as references to them can outlive a reset.
+std::vector<std::unique_ptr<const ReactNativeFeatureFlagsSnapshot>> snapshots_;
+
+std::atomic<const ReactNativeFeatureFlagsSnapshot*> snapshot_{nullptr};
+#endif
+
+} // namespace
 #pragma GCC diagnostic pop
 
+#ifndef RN_CONSTEXPR_FEATURE_FLAGS
 ${Object.entries(definitions.common)
   .map(
     ([flagName, flagConfig]) =>
@@ -44,26 +86,69 @@ ${Object.entries(definitions.common)
 }`,
   )
   .join('\n\n')}
+#endif
+
+void ReactNativeFeatureFlags::freeze() {
+  snapshot();
+}
+
+const ReactNativeFeatureFlagsSnapshot& ReactNativeFeatureFlags::snapshot() {
+#ifdef RN_CONSTEXPR_FEATURE_FLAGS
+  return constexprSnapshot_;
+#else
+  if (auto snapshot = snapshot_.load(std::memory_order_acquire)) {
+    return *snapshot;
+  }
+
+  std::lock_guard lock(snapshotMutex_);
+  if (auto snapshot = snapshot_.load(std::memory_order_relaxed)) {
+    return *snapshot;
+  }
+
+  const auto& snapshot = snapshots_.emplace_back(
+      std::make_unique<const ReactNativeFeatureFlagsSnapshot>(
+          getAccessor().snapshot()));
+  snapshot_.store(snapshot.get(), std::memory_order_release);
+  return *snapshot;
+#endif
+}
 
 void ReactNativeFeatureFlags::override(
     std::unique_ptr<ReactNativeFeatureFlagsProvider> provider) {
+#ifdef RN_CONSTEXPR_FEATURE_FLAGS
+  checkOverride(std::move(provider));
+#else
   getAccessor().override(std::move(provider));
+#endif
 }
 
 void ReactNativeFeatureFlags::dangerouslyReset() {
+  std::lock_guard lock(snapshotMutex_);
+#ifndef RN_CONSTEXPR_FEATURE_FLAGS
+  snapshot_ = nullptr;
+#endif
   accessor_ = std::make_unique<ReactNativeFeatureFlagsAccessor>();
 }
 
 std::optional<std::string> ReactNativeFeatureFlags::dangerouslyForceOverride(
     std::unique_ptr<ReactNativeFeatureFlagsProvider> provider) {
+#ifdef RN_CONSTEXPR_FEATURE_FLAGS
+  checkOverride(std::move(provider));
+  return std::nullopt;
+#else
   auto accessor = std::make_unique<ReactNativeFeatureFlagsAccessor>();
   accessor->override(std::move(provider));
 
-  std::swap(accessor_, accessor);
+  {
+    std::lock_guard lock(snapshotMutex_);
+    snapshot_ = nullptr;
+    std::swap(accessor_, accessor);
+  }
 
   // Now accessor is the old accessor
   return accessor == nullptr ? std::nullopt
                              : accessor->getAccessedFeatureFlagNames();
+#endif
 }
 
 ReactNativeFeatureFlagsAccessor& ReactNativeFeatureFlags::getAccessor() {
@@ -8,11 +8,17 @@
  * @format
  */
 
-import type {FeatureFlagDefinitions} from '../../types';
+import type {FeatureFlagDefinitions, FeatureFlagValue} from '../../types';
 
 import {DO_NOT_MODIFY_COMMENT, getCxxTypeFromDefaultValue} from '../../utils';
 import signedsource from 'signedsource';
 
+function getConstexprCxxType(defaultValue: FeatureFlagValue): string {
+  const type = getCxxTypeFromDefaultValue(defaultValue);
+  // \`std::string\` can't be used in constant expressions.
+  return type === 'std::string' ? 'const char*' : type;
+}
+
 export default function (definitions: FeatureFlagDefinitions): string {
   return signedsource.signFile(`/*
  * Copyright (c) Meta Platforms, Inc. and affiliates.
@@ -37,6 +43,42 @@ ${DO_NOT_MODIFY_COMMENT}
 #define RN_EXPORT __attribute__((visibility("default")))
 #endif
 
+#ifdef RN_CONSTEXPR_FEATURE_FLAGS
+namespace facebook::react {
+
+/**
+ * The values of the feature flags when \`RN_CONSTEXPR_FEATURE_FLAGS\` is
+ * defined.
+ *
+ * Builds can change them by defining \`RN_CONSTEXPR_FEATURE_FLAGS_VALUES\`
+ * as the path of a header that declares
+ * \`facebook::react::ReactNativeFeatureFlagsConstexprValues\`, extending this
+ * struct and redeclaring the flags they set (e.g.:
+ * \`static constexpr bool enableFabricRenderer = true;\`).
+ */
+struct ReactNativeFeatureFlagsConstexprDefaults {
+${Object.entries(definitions.common)
+  .map(
+    ([flagName, flagConfig]) =>
+      `  static constexpr ${getConstexprCxxType(
+        flagConfig.defaultValue,
+      )} ${flagName} = ${JSON.stringify(flagConfig.defaultValue)};`,
+  )
+  .join('\n')}
+};
+
+} // namespace facebook::react
+
+#ifdef RN_CONSTEXPR_FEATURE_FLAGS_VALUES
+#include RN_CONSTEXPR_FEATURE_FLAGS_VALUES
+#else
+namespace facebook::react {
+using ReactNativeFeatureFlagsConstexprValues =
+    ReactNativeFeatureFlagsConstexprDefaults;
+} // namespace facebook::react
+#endif
+#endif
+
 namespace facebook::react {
 
 /**
@@ -44,9 +86,26 @@ namespace facebook::react {
  *
  * All the methods are thread-safe (as long as the methods in the overridden
  * provider are).
+ *
+ * If \`RN_CONSTEXPR_FEATURE_FLAGS\` is defined, all the feature flags are
+ * compile-time constants (see \`ReactNativeFeatureFlagsConstexprDefaults\`),
+ * so the compiler can eliminate the code guarded by them. Overrides cannot
+ * change their values in that case.
  */
 class ReactNativeFeatureFlags {
  public:
+#ifdef RN_CONSTEXPR_FEATURE_FLAGS
+${Object.entries(definitions.common)
+  .map(
+    ([flagName, flagConfig]) =>
+      `  static constexpr ${getCxxTypeFromDefaultValue(
+        flagConfig.defaultValue,
+      )} ${flagName}() {
+    return ReactNativeFeatureFlagsConstexprValues::${flagName};
+  }`,
+  )
+  .join('\n\n')}
+#else
 ${Object.entries(definitions.common)
   .map(
     ([flagName, flagConfig]) =>
@@ -56,6 +115,28 @@ ${Object.entries(definitions.common)
   RN_EXPORT static ${getCxxTypeFromDefaultValue(flagConfig.defaultValue)} ${flagName}();`,
   )
   .join('\n\n')}
+#endif
+
+  /**
+   * Resolves all the feature flags once and makes every following access
+   * read the resolved values, without going through the provider again.
+   *
+   * Call this after overriding the feature flags, once their values are
+   * final (e.g.: after initializing the React Native runtime). The feature
+   * flags cannot be overridden after this (see \`dangerouslyReset\`).
+   */
+  RN_EXPORT static void freeze();
+
+  /**
+   * Returns the values of all the feature flags, freezing them if they
+   * weren't already.
+   *
+   * Code reading feature flags in hot paths (e.g.: for every node or every
+   * commit) can keep this reference and read the values from it directly.
+   * The reference stays valid after \`dangerouslyReset\`, but it keeps
+   * providing the values from before the reset.
+   */
+  RN_EXPORT static const ReactNativeFeatureFlagsSnapshot& snapshot();
 
   /**
    * Overrides the feature flags with the ones provided by the given provider
@@ -63,6 +144,9 @@ ${Object.entries(definitions.common)
    *
    * This method must be called before you initialize the React Native runtime.
    *
+   * If \`RN_CONSTEXPR_FEATURE_FLAGS\` is defined, the provider must return the
+   * compile-time values of the flags. This is only checked in debug builds.
+   *
    * @example
    *
    * \`\`\`
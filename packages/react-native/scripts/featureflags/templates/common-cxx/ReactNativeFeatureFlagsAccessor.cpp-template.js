@@ -35,7 +35,8 @@ namespace facebook::react {
 
 ReactNativeFeatureFlagsAccessor::ReactNativeFeatureFlagsAccessor()
     : currentProvider_(std::make_unique<ReactNativeFeatureFlagsDefaults>()),
-      wasOverridden_(false) {}
+      wasOverridden_(false),
+      wasFrozen_(false) {}
 
 ${Object.entries(definitions.common)
   .map(
@@ -43,6 +44,8 @@ ${Object.entries(definitions.common)
       `${getCxxTypeFromDefaultValue(
         flagConfig.defaultValue,
       )} ReactNativeFeatureFlagsAccessor::${flagName}() {
+  markFlagAsAccessed(${flagPosition}, "${flagName}");
+
   auto flagValue = ${flagName}_.load();
 
   if (!flagValue.has_value()) {
@@ -51,8 +54,6 @@ ${Object.entries(definitions.common)
     // be accessing the provider multiple times but the end state of this
     // instance and the returned flag value would be the same.
 
-    markFlagAsAccessed(${flagPosition}, "${flagName}");
-
     flagValue = currentProvider_->${flagName}();
     ${flagName}_ = flagValue;
   }
@@ -62,6 +63,27 @@ ${Object.entries(definitions.common)
   )
   .join('\n\n')}
 
+ReactNativeFeatureFlagsSnapshot ReactNativeFeatureFlagsAccessor::snapshot() {
+  // The snapshot resolves every flag, so it doesn't mark them as accessed
+  // (that would report flags that were never read). Overrides are rejected
+  // once it exists instead.
+  wasFrozen_ = true;
+
+${Object.keys(definitions.common)
+  .map(
+    flagName => `  if (!${flagName}_.load().has_value()) {
+    ${flagName}_ = currentProvider_->${flagName}();
+  }`,
+  )
+  .join('\n')}
+
+  return {
+${Object.keys(definitions.common)
+  .map(flagName => `      .${flagName} = ${flagName}_.load().value(),`)
+  .join('\n')}
+  };
+}
+
 void ReactNativeFeatureFlagsAccessor::override(
     std::unique_ptr<ReactNativeFeatureFlagsProvider> provider) {
   if (wasOverridden_) {
@@ -69,6 +91,11 @@ void ReactNativeFeatureFlagsAccessor::override(
         "Feature flags cannot be overridden more than once");
   }
 
+  if (wasFrozen_) {
+    throw std::runtime_error(
+        "Feature flags cannot be overridden after being frozen");
+  }
+
   ensureFlagsNotAccessed();
   wasOverridden_ = true;
   currentProvider_ = std::move(provider);
@@ -97,7 +124,11 @@ ReactNativeFeatureFlagsAccessor::getAccessedFeatureFlagNames() const {
 void ReactNativeFeatureFlagsAccessor::markFlagAsAccessed(
     int position,
     const char* flagName) {
-  accessedFeatureFlags_[position] = flagName;
+  // Every read marks its flag, so skip the store once it's marked.
+  if (accessedFeatureFlags_[position].load(std::memory_order_relaxed) ==
+      nullptr) {
+    accessedFeatureFlags_[position] = flagName;
+  }
 }
 
 void ReactNativeFeatureFlagsAccessor::ensureFlagsNotAccessed() {
@@ -36,6 +36,22 @@ ${DO_NOT_MODIFY_COMMENT}
 
 namespace facebook::react {
 
+/**
+ * The values of all the feature flags, resolved once so they can be read
+ * without any synchronization.
+ */
+struct ReactNativeFeatureFlagsSnapshot {
+${Object.entries(definitions.common)
+  .map(
+    ([flagName, flagConfig]) =>
+      `  ${getCxxTypeFromDefaultValue(flagConfig.defaultValue)} ${flagName};`,
+  )
+  .join('\n')}
+
+  bool operator==(const ReactNativeFeatureFlagsSnapshot& other) const =
+      default;
+};
+
 class ReactNativeFeatureFlagsAccessor {
  public:
   ReactNativeFeatureFlagsAccessor();
@@ -47,6 +63,8 @@ ${Object.entries(definitions.common)
   )
   .join('\n')}
 
+  ReactNativeFeatureFlagsSnapshot snapshot();
+
   void override(std::unique_ptr<ReactNativeFeatureFlagsProvider> provider);
   std::optional<std::string> getAccessedFeatureFlagNames() const;
 
@@ -56,6 +74,7 @@ ${Object.entries(definitions.common)
 
   std::unique_ptr<ReactNativeFeatureFlagsProvider> currentProvider_;
   bool wasOverridden_;
+  std::atomic<bool> wasFrozen_;
 
   std::array<std::atomic<const char*>, ${
     Object.keys(definitions.common).length